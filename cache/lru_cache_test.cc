@@ -2085,6 +2085,84 @@ TEST_P(DBSecondaryCacheTest, TestSecondaryCacheMultiGet) {
   Destroy(options);
 }
 
+// Records the largest batch of lookups waited on together
+class CacheWithWaitAllStats : public CacheWrapper {
+ public:
+  using CacheWrapper::CacheWrapper;
+
+  static const char* kClassName() { return "CacheWithWaitAllStats"; }
+  const char* Name() const override { return kClassName(); }
+
+  void WaitAll(AsyncLookupHandle* async_handles, size_t count) override {
+    max_wait_all_count_ = std::max(max_wait_all_count_, count);
+    target_->WaitAll(async_handles, count);
+  }
+
+  size_t GetMaxWaitAllCount() { return max_wait_all_count_; }
+  void ResetCount() { max_wait_all_count_ = 0; }
+
+ private:
+  size_t max_wait_all_count_ = 0;
+};
+
+TEST_P(DBSecondaryCacheTest, TestSecondaryCacheMultiGetPartitionedFilter) {
+  if (IsHyperClock()) {
+    ROCKSDB_GTEST_BYPASS("Test depends on LRUCache-specific behaviors");
+    return;
+  }
+  std::shared_ptr<TestSecondaryCache> secondary_cache(
+      new TestSecondaryCache(2048 * 1024));
+  std::shared_ptr<Cache> base_cache =
+      NewCache(1 << 20 /* capacity */, 0 /* num_shard_bits */,
+               false /* strict_capacity_limit */, secondary_cache);
+  auto cache = std::make_shared<CacheWithWaitAllStats>(base_cache);
+  BlockBasedTableOptions table_options;
+  table_options.block_cache = cache;
+  table_options.filter_policy.reset(NewBloomFilterPolicy(10));
+  table_options.partition_filters = true;
+  table_options.index_type =
+      BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+  // Many small filter partitions
+  table_options.metadata_block_size = 64;
+  table_options.cache_index_and_filter_blocks = true;
+  Options options = GetDefaultOptions();
+  options.create_if_missing = true;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  const int N = 1000;
+  for (int i = 0; i < N; i++) {
+    ASSERT_OK(Put(Key(2 * i), "value" + std::to_string(i)));
+  }
+  ASSERT_OK(Flush());
+
+  // Move everything to the secondary cache
+  base_cache->SetCapacity(0);
+  base_cache->SetCapacity(1 << 20);
+
+  // Keys that do not exist, spread over many filter partitions
+  std::vector<std::string> mget_keys;
+  for (int i = 0; i < N; i += N / 10) {
+    mget_keys.push_back(Key(2 * i + 1));
+  }
+  std::vector<Slice> key_slices(mget_keys.begin(), mget_keys.end());
+  std::vector<PinnableSlice> values(mget_keys.size());
+  std::vector<Status> statuses(mget_keys.size());
+  uint32_t num_lookups = secondary_cache->num_lookups();
+  cache->ResetCount();
+  dbfull()->MultiGet(ReadOptions(), dbfull()->DefaultColumnFamily(),
+                     key_slices.size(), key_slices.data(), values.data(),
+                     statuses.data(), false);
+  for (const Status& s : statuses) {
+    ASSERT_TRUE(s.IsNotFound());
+  }
+  // The filter partitions are fetched from the secondary cache together
+  ASSERT_GT(secondary_cache->num_lookups(), num_lookups + 1);
+  ASSERT_GT(cache->GetMaxWaitAllCount(), 1u);
+
+  Destroy(options);
+}
+
 class CacheWithStats : public CacheWrapper {
  public:
   using CacheWrapper::CacheWrapper;
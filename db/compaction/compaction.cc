@@ -1079,14 +1079,19 @@ void Compaction::FilterInputsForCompactionIterator() {
   size_t num_input_levels = inputs_.size();
   // TODO(yuzhangyu): filtering of older L0 file by new L0 file is not
   // supported yet.
-  FileMetaData* rangedel_candidate = inputs_[0].level == 0
-                                         ? inputs_[0].files.back()
-                                         : inputs_[0].files.front();
-  assert(rangedel_candidate);
-  if (!rangedel_candidate->FileIsStandAloneRangeTombstone() ||
-      !DataIsDefinitelyInSnapshot(rangedel_candidate->fd.smallest_seqno,
-                                  earliest_snapshot_.value(),
-                                  snapshot_checker_)) {
+  // The standalone range tombstone files among the start level inputs that
+  // are visible to all snapshots. In a leveled compaction, the start level
+  // can have several input files.
+  std::vector<const FileMetaData*> rangedel_candidates;
+  for (const FileMetaData* file : inputs_[0].files) {
+    if (file->FileIsStandAloneRangeTombstone() &&
+        DataIsDefinitelyInSnapshot(file->fd.smallest_seqno,
+                                   earliest_snapshot_.value(),
+                                   snapshot_checker_)) {
+      rangedel_candidates.push_back(file);
+    }
+  }
+  if (rangedel_candidates.empty()) {
     for (size_t level = 0; level < num_input_levels; level++) {
       DoGenerateLevelFilesBrief(&input_levels_[level], inputs_[level].files,
                                 &arena_);
@@ -1094,10 +1099,6 @@ void Compaction::FilterInputsForCompactionIterator() {
     return;
   }
 
-  Slice rangedel_start_ukey = rangedel_candidate->smallest.user_key();
-  Slice rangedel_end_ukey = rangedel_candidate->largest.user_key();
-  SequenceNumber rangedel_seqno = rangedel_candidate->fd.smallest_seqno;
-
   std::vector<std::vector<FileMetaData*>> non_start_level_input_files;
   non_start_level_input_files.reserve(num_input_levels - 1);
   non_start_level_input_files_filtered_.reserve(num_input_levels - 1);
@@ -1109,11 +1110,20 @@ void Compaction::FilterInputsForCompactionIterator() {
       // When range data and point data has the same sequence number, point
       // data wins. Range deletion end key is exclusive, so check it's bigger
       // than file right boundary user key.
-      if (rangedel_seqno > file->fd.largest_seqno &&
-          ucmp->CompareWithoutTimestamp(rangedel_start_ukey,
-                                        file->smallest.user_key()) <= 0 &&
-          ucmp->CompareWithoutTimestamp(rangedel_end_ukey,
-                                        file->largest.user_key()) > 0) {
+      bool covered = false;
+      for (const FileMetaData* rangedel_candidate : rangedel_candidates) {
+        if (rangedel_candidate->fd.smallest_seqno > file->fd.largest_seqno &&
+            ucmp->CompareWithoutTimestamp(
+                rangedel_candidate->smallest.user_key(),
+                file->smallest.user_key()) <= 0 &&
+            ucmp->CompareWithoutTimestamp(
+                rangedel_candidate->largest.user_key(),
+                file->largest.user_key()) > 0) {
+          covered = true;
+          break;
+        }
+      }
+      if (covered) {
         non_start_level_input_files_filtered_.back().back() = true;
         filtered_input_levels_[level].push_back(file);
       } else {
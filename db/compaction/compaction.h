@@ -489,9 +489,11 @@ class Compaction {
 
   // If oldest snapshot is specified at Compaction construction time, we have
   // an opportunity to optimize inputs for compaction iterator for this case:
-  // When a standalone range deletion file on the start level is recognized and
+  // When standalone range deletion files on the start level are recognized and
   // can be determined to completely shadow some input files on non-start level.
   // These files will be filtered out and later not feed to compaction iterator.
+  // They are still deleted when the compaction result is installed, so they
+  // are dropped without being read.
   void FilterInputsForCompactionIterator();
 
   // Get the atomic file boundaries for all files in the compaction. Necessary
@@ -554,7 +556,8 @@ class Compaction {
 
   // The earliest snapshot and snapshot checker at compaction picking time.
   // These fields are only set for deletion triggered compactions picked in
-  // universal compaction. And when user-defined timestamp is not enabled.
+  // universal compaction and for automatic leveled compactions. And when
+  // user-defined timestamp is not enabled.
   // It will be used to possibly filter out some non start level input files.
   std::optional<SequenceNumber> earliest_snapshot_;
   const SnapshotChecker* snapshot_checker_;
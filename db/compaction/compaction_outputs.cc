@@ -263,6 +263,24 @@ bool CompactionOutputs::ShouldStopBefore(const CompactionIterator& c_iter) {
     return true;
   }
 
+  // Files output to Level 0 are only split as configured for L0->L0
+  // compactions, and only between user keys, because L0 files from the same
+  // compaction share an epoch number and must not overlap.
+  if (compaction_->output_level() == 0) {
+    if (l0_output_file_size_ == 0 ||
+        compaction_->column_family_data()
+                ->user_comparator()
+                ->CompareWithoutTimestamp(last_key_for_partitioner_,
+                                          c_iter.user_key()) == 0) {
+      return false;
+    }
+    return current_output_file_size_ >= l0_output_file_size_ ||
+           (partitioner_ &&
+            partitioner_->ShouldPartition(PartitionerRequest(
+                last_key_for_partitioner_, c_iter.user_key(),
+                current_output_file_size_)) == kRequired);
+  }
+
   // If there's user defined partitioner, check that first
   if (partitioner_ && partitioner_->ShouldPartition(PartitionerRequest(
                           last_key_for_partitioner_, c_iter.user_key(),
@@ -270,11 +288,6 @@ bool CompactionOutputs::ShouldStopBefore(const CompactionIterator& c_iter) {
     return true;
   }
 
-  // files output to Level 0 won't be split
-  if (compaction_->output_level() == 0) {
-    return false;
-  }
-
   // reach the max file size
   if (current_output_file_size_ >= compaction_->max_output_file_size()) {
     return true;
@@ -395,7 +408,7 @@ Status CompactionOutputs::AddToOutput(
 
   // c_iter may emit range deletion keys, so update `last_key_for_partitioner_`
   // here before returning below when `is_range_del` is true
-  if (partitioner_) {
+  if (partitioner_ || l0_output_file_size_ > 0) {
     last_key_for_partitioner_.assign(c_iter.user_key().data_,
                                      c_iter.user_key().size_);
   }
@@ -794,7 +807,13 @@ void CompactionOutputs::FillFilesToCutForTtl() {
 CompactionOutputs::CompactionOutputs(const Compaction* compaction,
                                      const bool is_penultimate_level)
     : compaction_(compaction), is_penultimate_level_(is_penultimate_level) {
-  partitioner_ = compaction->output_level() == 0
+  if (compaction->output_level() == 0 &&
+      compaction->immutable_options().compaction_style ==
+          kCompactionStyleLevel) {
+    l0_output_file_size_ =
+        compaction->mutable_cf_options().intra_l0_compaction_output_file_size;
+  }
+  partitioner_ = compaction->output_level() == 0 && l0_output_file_size_ == 0
                      ? nullptr
                      : compaction->CreateSstPartitioner();
 
@@ -315,6 +315,10 @@ class CompactionOutputs {
   std::string last_key_for_partitioner_;
   std::unique_ptr<SstPartitioner> partitioner_;
 
+  // Size of the files to split the output of an L0->L0 compaction into, 0 if
+  // it is not split
+  uint64_t l0_output_file_size_ = 0;
+
   // A flag determines if this subcompaction has been split by the cursor
   // for RoundRobin compaction
   bool is_split_ = false;
@@ -58,6 +58,7 @@ bool FindIntraL0Compaction(const std::vector<FileMetaData*>& level_files,
     compact_bytes_per_del_file = new_compact_bytes_per_del_file;
   }
 
+  limit = L0CompactionInputsLimit(level_files, limit);
   if ((limit - start) >= min_files_to_compact &&
       compact_bytes_per_del_file < max_compact_bytes_per_del_file) {
     assert(comp_inputs != nullptr);
@@ -70,6 +71,17 @@ bool FindIntraL0Compaction(const std::vector<FileMetaData*>& level_files,
   return false;
 }
 
+size_t L0CompactionInputsLimit(const std::vector<FileMetaData*>& level_files,
+                               size_t limit) {
+  while (limit > 0 && limit < level_files.size() &&
+         level_files[limit]->epoch_number != kUnknownEpochNumber &&
+         level_files[limit - 1]->epoch_number ==
+             level_files[limit]->epoch_number) {
+    --limit;
+  }
+  return limit;
+}
+
 // Determine compression type, based on user options, level of the output
 // file and whether compression is disabled.
 // If enable_compression is false, then compression is always disabled no
@@ -987,6 +999,22 @@ Status CompactionPicker::SanitizeCompactionInputFilesForAllLevels(
       }
     } else if (output_level > 0) {
       last_included = static_cast<int>(current_files.size() - 1);
+    } else {
+      // Include all the L0 files with the same epoch number as an input file,
+      // which the output would overlap otherwise
+      while (first_included > 0 && current_files[first_included].epoch_number !=
+                                       kUnknownEpochNumber &&
+             current_files[first_included - 1].epoch_number ==
+                 current_files[first_included].epoch_number) {
+        first_included--;
+      }
+      while (last_included < static_cast<int>(current_files.size()) - 1 &&
+             current_files[last_included].epoch_number !=
+                 kUnknownEpochNumber &&
+             current_files[last_included + 1].epoch_number ==
+                 current_files[last_included].epoch_number) {
+        last_included++;
+      }
     }
 
     // include all files between the first and the last compaction input files.
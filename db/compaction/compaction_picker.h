@@ -314,6 +314,13 @@ bool FindIntraL0Compaction(const std::vector<FileMetaData*>& level_files,
                            uint64_t max_compaction_bytes,
                            CompactionInputFiles* comp_inputs);
 
+// Returns the largest limit <= `limit` such that the L0 files
+// `level_files[0, limit)` do not include only some of the files with the
+// same epoch number (written by the same intra-L0 compaction). The output of
+// an L0->L0 compaction must not overlap an L0 file with its epoch number.
+size_t L0CompactionInputsLimit(const std::vector<FileMetaData*>& level_files,
+                               size_t limit);
+
 CompressionType GetCompressionType(const VersionStorageInfo* vstorage,
                                    const MutableCFOptions& mutable_cf_options,
                                    int level, int base_level,
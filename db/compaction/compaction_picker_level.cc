@@ -61,14 +61,25 @@ class LevelCompactionBuilder {
                          LogBuffer* log_buffer,
                          const MutableCFOptions& mutable_cf_options,
                          const ImmutableOptions& ioptions,
-                         const MutableDBOptions& mutable_db_options)
+                         const MutableDBOptions& mutable_db_options,
+                         const std::vector<SequenceNumber>& existing_snapshots,
+                         const SnapshotChecker* snapshot_checker)
       : cf_name_(cf_name),
         vstorage_(vstorage),
         compaction_picker_(compaction_picker),
         log_buffer_(log_buffer),
         mutable_cf_options_(mutable_cf_options),
         ioptions_(ioptions),
-        mutable_db_options_(mutable_db_options) {}
+        mutable_db_options_(mutable_db_options) {
+    // These parameters are only passed when user-defined timestamp is not
+    // enabled.
+    if (ioptions_.user_comparator->timestamp_size() == 0) {
+      earliest_snapshot_ = existing_snapshots.empty()
+                               ? kMaxSequenceNumber
+                               : existing_snapshots.at(0);
+      snapshot_checker_ = snapshot_checker;
+    }
+  }
 
   // Pick and return a compaction.
   Compaction* PickCompaction();
@@ -156,6 +167,12 @@ class LevelCompactionBuilder {
   const MutableCFOptions& mutable_cf_options_;
   const ImmutableOptions& ioptions_;
   const MutableDBOptions& mutable_db_options_;
+  // Optional earliest snapshot at time of compaction picking. This is only
+  // provided if the column family doesn't enable user-defined timestamps. It
+  // lets the compaction skip the input files that are fully covered by a
+  // standalone range tombstone file among its start level inputs.
+  std::optional<SequenceNumber> earliest_snapshot_;
+  const SnapshotChecker* snapshot_checker_ = nullptr;
   // Pick a path ID to place a newly generated file, with its level
   static uint32_t GetPathId(const ImmutableCFOptions& ioptions,
                             const MutableCFOptions& mutable_cf_options,
@@ -559,9 +576,8 @@ Compaction* LevelCompactionBuilder::GetCompaction() {
                          vstorage_->base_level()),
       GetCompressionOptions(mutable_cf_options_, vstorage_, output_level_),
       mutable_cf_options_.default_write_temperature,
-      /* max_subcompactions */ 0, std::move(grandparents_),
-      /* earliest_snapshot */ std::nullopt, /* snapshot_checker */ nullptr,
-      is_manual_,
+      /* max_subcompactions */ 0, std::move(grandparents_), earliest_snapshot_,
+      snapshot_checker_, is_manual_,
       /* trim_ts */ "", start_level_score_, false /* deletion_compaction */,
       l0_files_might_overlap, compaction_reason_);
 
@@ -956,14 +972,14 @@ bool LevelCompactionBuilder::PickSizeBasedIntraL0Compaction() {
     return false;
   }
 
+  size_t limit = 0;
+  while (limit < l0_files.size() && !l0_files[limit]->being_compacted) {
+    ++limit;
+  }
+  limit = L0CompactionInputsLimit(l0_files, limit);
   start_level_inputs_.clear();
   start_level_inputs_.level = 0;
-  for (const auto& file : l0_files) {
-    if (file->being_compacted) {
-      break;
-    }
-    start_level_inputs_.files.push_back(file);
-  }
+  start_level_inputs_.files.assign(l0_files.begin(), l0_files.begin() + limit);
   if (start_level_inputs_.files.size() < min_num_file) {
     start_level_inputs_.clear();
     return false;
@@ -976,12 +992,13 @@ bool LevelCompactionBuilder::PickSizeBasedIntraL0Compaction() {
 Compaction* LevelCompactionPicker::PickCompaction(
     const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
     const MutableDBOptions& mutable_db_options,
-    const std::vector<SequenceNumber>& /*existing_snapshots */,
-    const SnapshotChecker* /*snapshot_checker*/, VersionStorageInfo* vstorage,
+    const std::vector<SequenceNumber>& existing_snapshots,
+    const SnapshotChecker* snapshot_checker, VersionStorageInfo* vstorage,
     LogBuffer* log_buffer) {
   LevelCompactionBuilder builder(cf_name, vstorage, this, log_buffer,
                                  mutable_cf_options, ioptions_,
-                                 mutable_db_options);
+                                 mutable_db_options, existing_snapshots,
+                                 snapshot_checker);
   return builder.PickCompaction();
 }
 }  // namespace ROCKSDB_NAMESPACE
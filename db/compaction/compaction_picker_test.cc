@@ -1568,6 +1568,173 @@ TEST_F(CompactionPickerTest, CompactionPriMinOverlapping4) {
   ASSERT_EQ(6U, compaction->input(0, 0)->fd.GetNumber());
 }
 
+TEST_F(CompactionPickerTest, CompactionPriMaxBenefitPerCost1) {
+  NewVersionStorage(6, kCompactionStyleLevel);
+  ioptions_.compaction_pri = kMaxBenefitPerCost;
+  mutable_cf_options_.target_file_size_base = 100000000000;
+  mutable_cf_options_.target_file_size_multiplier = 10;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.compaction_pri_bytes_per_read = 4096;
+  mutable_cf_options_.compaction_pri_space_weight = 1.0;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+
+  // File 8 has the smallest overlapping ratio. File 7 overlaps a lot more
+  // data, but it carries deletions.
+  Add(2, 6U, "150", "179", 50000000U);
+  Add(2, 7U, "180", "220", 50000000U, 0, 100, 100,
+      /*compensated_file_size=*/500000000U);
+  Add(2, 8U, "321", "400", 50000000U);
+  Add(3, 26U, "150", "179", 60000000U);
+  Add(3, 27U, "180", "220", 260000000U);
+  Add(3, 28U, "321", "400", 50000000U);
+  UpdateVersionStorageInfo();
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  // The space reclaimed from file 7 outweighs its larger overlap
+  ASSERT_EQ(7U, compaction->input(0, 0)->fd.GetNumber());
+}
+
+TEST_F(CompactionPickerTest, CompactionPriMaxBenefitPerCost2) {
+  NewVersionStorage(6, kCompactionStyleLevel);
+  ioptions_.compaction_pri = kMaxBenefitPerCost;
+  mutable_cf_options_.target_file_size_base = 100000000000;
+  mutable_cf_options_.target_file_size_multiplier = 10;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.compaction_pri_bytes_per_read = 0;
+  mutable_cf_options_.compaction_pri_space_weight = 0.0;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+
+  // Same files as above, and file 6 is read a lot
+  Add(2, 6U, "150", "179", 50000000U);
+  Add(2, 7U, "180", "220", 50000000U, 0, 100, 100,
+      /*compensated_file_size=*/500000000U);
+  Add(2, 8U, "321", "400", 50000000U);
+  Add(3, 26U, "150", "179", 60000000U);
+  Add(3, 27U, "180", "220", 260000000U);
+  Add(3, 28U, "321", "400", 50000000U);
+  file_map_[6U].first->stats.num_reads_sampled = 10000;
+  UpdateVersionStorageInfo();
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  // Ignoring space and reads, the file with the smallest overlapping
+  // ratio is picked
+  ASSERT_EQ(8U, compaction->input(0, 0)->fd.GetNumber());
+}
+
+TEST_F(CompactionPickerTest, CompactionPriMaxBenefitPerCost3) {
+  NewVersionStorage(6, kCompactionStyleLevel);
+  ioptions_.compaction_pri = kMaxBenefitPerCost;
+  mutable_cf_options_.target_file_size_base = 100000000000;
+  mutable_cf_options_.target_file_size_multiplier = 10;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.compaction_pri_bytes_per_read = 4096;
+  mutable_cf_options_.compaction_pri_space_weight = 1.0;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+
+  // File 6 overlaps a bit more data than file 8, but it is read a lot
+  Add(2, 6U, "150", "179", 50000000U);
+  Add(2, 8U, "321", "400", 50000000U);
+  Add(2, 9U, "500", "600", 50000000U);
+  Add(3, 26U, "150", "179", 60000000U);
+  Add(3, 28U, "321", "400", 50000000U);
+  Add(3, 29U, "500", "600", 500000000U);
+  file_map_[6U].first->stats.num_reads_sampled = 10000;
+  UpdateVersionStorageInfo();
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  // Saving the reads of file 6 is worth its larger overlap
+  ASSERT_EQ(6U, compaction->input(0, 0)->fd.GetNumber());
+}
+
+TEST_F(CompactionPickerTest, CompactionPriMaxBenefitPerCostReadHeatDecay) {
+  NewVersionStorage(6, kCompactionStyleLevel);
+  ioptions_.compaction_pri = kMaxBenefitPerCost;
+  mutable_cf_options_.target_file_size_base = 100000000000;
+  mutable_cf_options_.target_file_size_multiplier = 10;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.compaction_pri_bytes_per_read = 4096;
+  mutable_cf_options_.compaction_pri_read_half_life_seconds = 3600;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+
+  // Same files as above, but file 6 was read ten half-lives ago
+  Add(2, 6U, "150", "179", 50000000U);
+  Add(2, 8U, "321", "400", 50000000U);
+  Add(2, 9U, "500", "600", 50000000U);
+  Add(3, 26U, "150", "179", 60000000U);
+  Add(3, 28U, "321", "400", 50000000U);
+  Add(3, 29U, "500", "600", 500000000U);
+  int64_t now = 0;
+  ASSERT_OK(ioptions_.clock->GetCurrentTime(&now));
+  FileSampledStats& stats = file_map_[6U].first->stats;
+  stats.num_reads_sampled = 10000;
+  stats.read_heat = 10000;
+  stats.num_reads_at_read_heat_update = 10000;
+  stats.read_heat_update_time = static_cast<uint64_t>(now) - 10 * 3600;
+  UpdateVersionStorageInfo();
+  ASSERT_LT(stats.read_heat, 10.0 + 1e-6);
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  // Too few reads are left to make up for the larger overlap
+  ASSERT_EQ(8U, compaction->input(0, 0)->fd.GetNumber());
+}
+
+TEST_F(CompactionPickerTest, CompactionPriMaxBenefitPerCostWriteBurst) {
+  NewVersionStorage(6, kCompactionStyleLevel);
+  ioptions_.compaction_pri = kMaxBenefitPerCost;
+  mutable_cf_options_.target_file_size_base = 100000000000;
+  mutable_cf_options_.target_file_size_multiplier = 10;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.level0_file_num_compaction_trigger = 100;
+  mutable_cf_options_.level0_slowdown_writes_trigger = 2;
+  mutable_cf_options_.compaction_pri_bytes_per_read = 4096;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+
+  // L0 has reached the slowdown trigger, but L2 is the level most in need
+  // of compaction
+  Add(0, 1U, "700", "800");
+  Add(0, 2U, "700", "800");
+  // File 6 is read a little, not enough to make up for its larger overlap
+  // than file 8
+  Add(2, 6U, "150", "179", 50000000U);
+  Add(2, 8U, "321", "400", 50000000U);
+  Add(2, 9U, "500", "600", 50000000U);
+  Add(3, 26U, "150", "179", 60000000U);
+  Add(3, 28U, "321", "400", 50000000U);
+  Add(3, 29U, "500", "600", 500000000U);
+  file_map_[6U].first->stats.num_reads_sampled = 1024;
+  UpdateVersionStorageInfo();
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(2, compaction->start_level());
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  // Cold files go last in a write burst
+  ASSERT_EQ(6U, compaction->input(0, 0)->fd.GetNumber());
+}
+
 TEST_F(CompactionPickerTest, CompactionPriRoundRobin) {
   std::vector<InternalKey> test_cursors = {InternalKey("249", 100, kTypeValue),
                                            InternalKey("600", 100, kTypeValue),
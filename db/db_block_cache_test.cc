@@ -6,6 +6,7 @@
 // Copyright (c) 2011 The LevelDB Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
+#include <cinttypes>
 #include <cstdlib>
 #include <functional>
 #include <memory>
@@ -656,6 +657,7 @@ class MockCache : public LRUCache {
  public:
   static uint32_t high_pri_insert_count;
   static uint32_t low_pri_insert_count;
+  static uint32_t bottom_pri_insert_count;
 
   MockCache()
       : LRUCache(LRUCacheOptions(
@@ -670,6 +672,8 @@ class MockCache : public LRUCache {
                 CompressionType type) override {
     if (priority == Priority::LOW) {
       low_pri_insert_count++;
+    } else if (priority == Priority::BOTTOM) {
+      bottom_pri_insert_count++;
     } else {
       high_pri_insert_count++;
     }
@@ -680,6 +684,7 @@ class MockCache : public LRUCache {
 
 uint32_t MockCache::high_pri_insert_count = 0;
 uint32_t MockCache::low_pri_insert_count = 0;
+uint32_t MockCache::bottom_pri_insert_count = 0;
 
 }  // anonymous namespace
 
@@ -740,6 +745,189 @@ TEST_F(DBBlockCacheTest, IndexAndFilterBlocksCachePriority) {
   }
 }
 
+TEST_F(DBBlockCacheTest, ScanDataBlocksCachePriority) {
+  ReadOptions default_read_options;
+  ReadOptions async_io_read_options;
+  async_io_read_options.async_io = true;
+  ReadOptions readahead_read_options;
+  readahead_read_options.readahead_size = 64 << 10;
+  for (bool bottom_priority_for_scan_blocks : {false, true}) {
+    for (const ReadOptions* read_options :
+         {&default_read_options, &async_io_read_options,
+          &readahead_read_options}) {
+      Options options = CurrentOptions();
+      options.create_if_missing = true;
+      options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+      options.compression = kNoCompression;
+      BlockBasedTableOptions table_options;
+      table_options.block_cache.reset(new MockCache());
+      table_options.block_size = 1024;
+      table_options.bottom_priority_for_scan_blocks =
+          bottom_priority_for_scan_blocks;
+      options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+      DestroyAndReopen(options);
+
+      Random rnd(301);
+      for (int i = 0; i < 100; ++i) {
+        ASSERT_OK(Put(Key(i), rnd.RandomString(100)));
+      }
+      ASSERT_OK(Flush());
+
+      // Point lookups are not affected
+      MockCache::high_pri_insert_count = 0;
+      MockCache::low_pri_insert_count = 0;
+      MockCache::bottom_pri_insert_count = 0;
+      ASSERT_NE("NOT_FOUND", Get(Key(50)));
+      ASSERT_EQ(1u, MockCache::low_pri_insert_count);
+      ASSERT_EQ(0u, MockCache::bottom_pri_insert_count);
+
+      // Neither are short scans, even with readahead from the first block
+      MockCache::low_pri_insert_count = 0;
+      {
+        std::unique_ptr<Iterator> iter(db_->NewIterator(*read_options));
+        iter->Seek(Key(10));
+        ASSERT_TRUE(iter->Valid());
+        iter->Next();
+        ASSERT_OK(iter->status());
+      }
+      ASSERT_GE(MockCache::low_pri_insert_count, 1u);
+      ASSERT_EQ(0u, MockCache::bottom_pri_insert_count);
+
+      // Start over with an empty cache
+      table_options.block_cache.reset(new MockCache());
+      options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+      Reopen(options);
+      MockCache::high_pri_insert_count = 0;
+      MockCache::low_pri_insert_count = 0;
+      MockCache::bottom_pri_insert_count = 0;
+      ASSERT_OK(options.statistics->Reset());
+      {
+        std::unique_ptr<Iterator> iter(db_->NewIterator(*read_options));
+        int num_keys = 0;
+        for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+          ++num_keys;
+        }
+        ASSERT_OK(iter->status());
+        ASSERT_EQ(100, num_keys);
+      }
+      const uint64_t num_data_blocks_added =
+          TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD);
+      ASSERT_GT(num_data_blocks_added,
+                table_options.num_file_reads_for_auto_readahead + 1);
+      ASSERT_EQ(0u, MockCache::high_pri_insert_count);
+      if (bottom_priority_for_scan_blocks) {
+        // The first blocks are read before the scan is detected as sequential
+        ASSERT_EQ(table_options.num_file_reads_for_auto_readahead,
+                  MockCache::low_pri_insert_count);
+        ASSERT_EQ(num_data_blocks_added -
+                      table_options.num_file_reads_for_auto_readahead,
+                  MockCache::bottom_pri_insert_count);
+      } else {
+        ASSERT_EQ(num_data_blocks_added, MockCache::low_pri_insert_count);
+        ASSERT_EQ(0u, MockCache::bottom_pri_insert_count);
+      }
+    }
+  }
+}
+
+TEST_F(DBBlockCacheTest, BlockCacheSimulation) {
+  Options options = CurrentOptions();
+  options.create_if_missing = true;
+  options.compression = kNoCompression;
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  std::string value;
+  ASSERT_FALSE(
+      db_->GetProperty(DB::Properties::kBlockCacheSimulation, &value));
+
+  // A simulated cache too small for any block, and one large enough for all
+  // of them
+  options.block_cache_simulation_capacities = {1 << 30, 1};
+  options.block_cache_simulation_sampling_frequency = 1;
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(100)));
+  }
+  ASSERT_OK(Flush());
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_NE("NOT_FOUND", Get(Key(i)));
+    }
+  }
+
+  ASSERT_TRUE(db_->GetProperty(DB::Properties::kBlockCacheSimulation, &value));
+  std::vector<std::string> lines = StringSplit(value, '\n');
+  ASSERT_EQ(2, lines.size());
+  // Sorted by capacity
+  ASSERT_TRUE(lines[0].find("capacity: 1 ") == 0) << lines[0];
+  ASSERT_TRUE(lines[0].find("miss ratio: 100.00 ") != std::string::npos)
+      << lines[0];
+  ASSERT_TRUE(lines[1].find("capacity: 1073741824 ") == 0) << lines[1];
+  // Each data block is only missed on first access, out of 10 rounds
+  double miss_ratio = 0;
+  ASSERT_EQ(1, sscanf(lines[1].c_str() + lines[1].find("miss ratio: "),
+                      "miss ratio: %lf", &miss_ratio));
+  ASSERT_GT(miss_ratio, 0.0);
+  ASSERT_LT(miss_ratio, 20.0);
+}
+
+TEST_F(DBBlockCacheTest, BlockCacheSimulationSampling) {
+  Options options = CurrentOptions();
+  options.create_if_missing = true;
+  options.compression = kNoCompression;
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  options.block_cache_simulation_capacities = {1 << 30};
+  options.block_cache_simulation_sampling_frequency = 4;
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(100)));
+  }
+  ASSERT_OK(Flush());
+
+  // No access record is built for the blocks that are not sampled
+  std::atomic<uint64_t> num_records{0};
+  SyncPoint::GetInstance()->SetCallBack(
+      "BlockBasedTable::FinishTraceRecord",
+      [&](void* /*arg*/) { num_records.fetch_add(1); });
+  SyncPoint::GetInstance()->EnableProcessing();
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      ASSERT_NE("NOT_FOUND", Get(Key(i)));
+    }
+    std::vector<std::string> keys;
+    for (int i = 0; i < 10; ++i) {
+      keys.push_back(Key(i * 100));
+    }
+    for (const auto& value : MultiGet(keys, /*snapshot=*/nullptr)) {
+      ASSERT_NE("NOT_FOUND", value);
+    }
+  }
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+
+  std::string value;
+  ASSERT_TRUE(db_->GetProperty(DB::Properties::kBlockCacheSimulation, &value));
+  uint64_t num_simulated = 0;
+  ASSERT_EQ(1, sscanf(value.c_str() + value.find("accesses: "),
+                      "accesses: %" SCNu64, &num_simulated));
+  uint64_t num_accesses =
+      TestGetTickerCount(options, BLOCK_CACHE_HIT) +
+      TestGetTickerCount(options, BLOCK_CACHE_MISS);
+  ASSERT_GT(num_simulated, 0);
+  ASSERT_LT(num_simulated, num_accesses);
+  ASSERT_EQ(num_simulated, num_records.load());
+}
+
 namespace {
 
 // An LRUCache wrapper that can falsely report "not found" on Lookup.
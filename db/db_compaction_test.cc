@@ -3956,6 +3956,72 @@ TEST_P(DBCompactionTestWithParam, IntraL0CompactionDoesNotObsoleteDeletions) {
   ASSERT_TRUE(db_->Get(roptions, Key(0), &result).IsNotFound());
 }
 
+TEST_F(DBCompactionTest, IntraL0CompactionSplitOutput) {
+  Options options = CurrentOptions();
+  options.compression = kNoCompression;
+  options.disable_auto_compactions = true;
+  options.intra_l0_compaction_output_file_size = 32 << 10;  // 32KB
+  DestroyAndReopen(options);
+
+  auto get_l0_files = [&]() {
+    ColumnFamilyMetaData cf_meta;
+    db_->GetColumnFamilyMetaData(&cf_meta);
+    return cf_meta.levels[0].files;
+  };
+  auto get_l0_sorted_runs = [&]() {
+    ColumnFamilyData* cfd =
+        dbfull()->GetVersionSet()->GetColumnFamilySet()->GetDefault();
+    return cfd->current()->storage_info()->l0_delay_trigger_count();
+  };
+
+  // Four overlapping L0 files of about 100KB
+  Random rnd(301);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 100; ++j) {
+      ASSERT_OK(Put(Key(j), rnd.RandomString(1000)));
+    }
+    ASSERT_OK(Flush());
+  }
+  ASSERT_EQ(4, get_l0_sorted_runs());
+  std::vector<std::string> input_files;
+  for (const auto& file : get_l0_files()) {
+    input_files.push_back(file.name);
+  }
+  ASSERT_OK(db_->CompactFiles(CompactionOptions(), input_files,
+                              /*output_level=*/0));
+
+  // The output is split into non-overlapping files of the same epoch
+  std::vector<SstFileMetaData> l0_files = get_l0_files();
+  ASSERT_GE(l0_files.size(), 3);
+  std::sort(l0_files.begin(), l0_files.end(),
+            [](const SstFileMetaData& a, const SstFileMetaData& b) {
+              return a.smallestkey < b.smallestkey;
+            });
+  for (size_t i = 1; i < l0_files.size(); ++i) {
+    ASSERT_EQ(l0_files[0].epoch_number, l0_files[i].epoch_number);
+    ASSERT_LT(l0_files[i - 1].largestkey, l0_files[i].smallestkey);
+  }
+  ASSERT_EQ(1, get_l0_sorted_runs());
+
+  // Compacting one of those files with a newer one includes all of them
+  ASSERT_OK(Put(Key(0), "new_value"));
+  ASSERT_OK(Flush());
+  ASSERT_EQ(2, get_l0_sorted_runs());
+  std::vector<SstFileMetaData> new_l0_files = get_l0_files();
+  ASSERT_OK(db_->CompactFiles(
+      CompactionOptions(),
+      {new_l0_files[0].name, new_l0_files[1].name},
+      /*output_level=*/0));
+  ASSERT_EQ(1, get_l0_sorted_runs());
+
+  ASSERT_EQ("new_value", Get(Key(0)));
+  Reopen(options);
+  ASSERT_EQ("new_value", Get(Key(0)));
+  for (int j = 1; j < 100; ++j) {
+    ASSERT_EQ(1000, Get(Key(j)).size());
+  }
+}
+
 TEST_P(DBCompactionTestWithParam, FullCompactionInBottomPriThreadPool) {
   const int kNumFilesTrigger = 3;
   Env::Default()->SetBackgroundThreads(1, Env::Priority::BOTTOM);
@@ -0,0 +1,260 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "db/db_test_util.h"
+#include "port/port.h"
+#include "rocksdb/sst_file_writer.h"
+#include "test_util/testutil.h"
+#include "util/random.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+class DBHotRowCacheTest : public DBTestBase {
+ public:
+  DBHotRowCacheTest()
+      : DBTestBase("db_hot_row_cache_test", /*env_do_fsync=*/false) {}
+
+  Options GetHotRowCacheOptions() {
+    Options options = CurrentOptions();
+    options.create_if_missing = true;
+    options.statistics = CreateDBStatistics();
+    options.hot_row_cache = NewLRUCache(1 << 20);
+    return options;
+  }
+
+  uint64_t Hits() {
+    return options_.statistics->getTickerCount(HOT_ROW_CACHE_HIT);
+  }
+  uint64_t Misses() {
+    return options_.statistics->getTickerCount(HOT_ROW_CACHE_MISS);
+  }
+
+  void Open(const Options& options) {
+    options_ = options;
+    DestroyAndReopen(options_);
+  }
+
+ private:
+  Options options_;
+};
+
+TEST_F(DBHotRowCacheTest, GetHitAndInvalidateOnWrite) {
+  Open(GetHotRowCacheOptions());
+
+  ASSERT_OK(Put("foo", "v1"));
+  ASSERT_OK(Flush());
+
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Hits(), 0);
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Hits(), 1);
+
+  // Negative results are cached as well
+  ASSERT_EQ(Get("bar"), "NOT_FOUND");
+  ASSERT_EQ(Get("bar"), "NOT_FOUND");
+  ASSERT_EQ(Hits(), 2);
+
+  ASSERT_OK(Put("foo", "v2"));
+  ASSERT_EQ(Get("foo"), "v2");
+  ASSERT_EQ(Get("foo"), "v2");
+  ASSERT_EQ(Hits(), 3);
+
+  ASSERT_OK(Delete("foo"));
+  ASSERT_EQ(Get("foo"), "NOT_FOUND");
+
+  ASSERT_OK(Put("bar", "v3"));
+  ASSERT_EQ(Get("bar"), "v3");
+
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(), "a",
+                             "z"));
+  ASSERT_EQ(Get("bar"), "NOT_FOUND");
+  ASSERT_EQ(Hits(), 3);
+}
+
+TEST_F(DBHotRowCacheTest, Snapshot) {
+  Open(GetHotRowCacheOptions());
+
+  ASSERT_OK(Put("foo", "v1"));
+  const Snapshot* snapshot = db_->GetSnapshot();
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Get("foo", snapshot), "v1");
+  ASSERT_EQ(Hits(), 1);
+
+  ASSERT_OK(Put("foo", "v2"));
+  // Populated with the latest value, which must not be served to the
+  // snapshot
+  ASSERT_EQ(Get("foo"), "v2");
+  ASSERT_EQ(Get("foo", snapshot), "v1");
+  ASSERT_EQ(Get("foo", snapshot), "v1");
+  ASSERT_EQ(Get("foo"), "v2");
+
+  db_->ReleaseSnapshot(snapshot);
+}
+
+TEST_F(DBHotRowCacheTest, ColumnFamilies) {
+  Options options = GetHotRowCacheOptions();
+  Open(options);
+  CreateAndReopenWithCF({"pikachu"}, options);
+
+  ASSERT_OK(Put(0, "foo", "v0"));
+  ASSERT_OK(Put(1, "foo", "v1"));
+  ASSERT_EQ(Get(0, "foo"), "v0");
+  ASSERT_EQ(Get(1, "foo"), "v1");
+  ASSERT_EQ(Get(0, "foo"), "v0");
+  ASSERT_EQ(Get(1, "foo"), "v1");
+  ASSERT_EQ(Hits(), 2);
+
+  ASSERT_OK(Put(1, "foo", "v2"));
+  ASSERT_EQ(Get(0, "foo"), "v0");
+  ASSERT_EQ(Get(1, "foo"), "v2");
+  ASSERT_EQ(Hits(), 3);
+}
+
+TEST_F(DBHotRowCacheTest, Entity) {
+  Open(GetHotRowCacheOptions());
+
+  const WideColumns columns{{kDefaultWideColumnName, "def"}, {"a", "va"}};
+  ASSERT_OK(db_->PutEntity(WriteOptions(), db_->DefaultColumnFamily(), "foo",
+                           columns));
+
+  // A plain value lookup cannot be served to GetEntity
+  ASSERT_EQ(Get("foo"), "def");
+  ASSERT_EQ(Get("foo"), "def");
+  ASSERT_EQ(Hits(), 1);
+
+  for (int i = 0; i < 2; ++i) {
+    PinnableWideColumns result;
+    ASSERT_OK(db_->GetEntity(ReadOptions(), db_->DefaultColumnFamily(), "foo",
+                             &result));
+    ASSERT_EQ(result.columns(), columns);
+  }
+  ASSERT_EQ(Hits(), 2);
+
+  // An entity lookup can be served to Get
+  ASSERT_EQ(Get("foo"), "def");
+  ASSERT_EQ(Hits(), 3);
+}
+
+TEST_F(DBHotRowCacheTest, MultiGet) {
+  Open(GetHotRowCacheOptions());
+
+  ASSERT_OK(Put("a", "va"));
+  ASSERT_OK(Put("b", "vb"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(Put("c", "vc"));
+
+  ASSERT_EQ(Get("b"), "vb");
+  ASSERT_EQ(Hits(), 0);
+
+  std::vector<std::string> keys{"a", "b", "c", "d"};
+  std::vector<std::string> expected{"va", "vb", "vc", "NOT_FOUND"};
+  ASSERT_EQ(MultiGet(keys, nullptr), expected);
+  ASSERT_EQ(Hits(), 1);
+  ASSERT_EQ(MultiGet(keys, nullptr), expected);
+  ASSERT_EQ(Hits(), 5);
+
+  ASSERT_OK(Put("a", "va2"));
+  expected[0] = "va2";
+  ASSERT_EQ(MultiGet(keys, nullptr), expected);
+  ASSERT_EQ(Hits(), 8);
+}
+
+TEST_F(DBHotRowCacheTest, IngestExternalFile) {
+  Options options = GetHotRowCacheOptions();
+  Open(options);
+
+  ASSERT_OK(Put("foo", "v1"));
+  ASSERT_EQ(Get("foo"), "v1");
+
+  const std::string file_path = dbname_ + "/ingest.sst";
+  SstFileWriter writer(EnvOptions(), options);
+  ASSERT_OK(writer.Open(file_path));
+  ASSERT_OK(writer.Put("foo", "v2"));
+  ASSERT_OK(writer.Finish());
+  ASSERT_OK(db_->IngestExternalFile({file_path}, IngestExternalFileOptions()));
+
+  ASSERT_EQ(Get("foo"), "v2");
+}
+
+TEST_F(DBHotRowCacheTest, IgnoreRangeDeletions) {
+  Open(GetHotRowCacheOptions());
+
+  ASSERT_OK(Put("foo", "v1"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(), "a",
+                             "z"));
+
+  // Sees the deleted value, which must not be cached
+  ReadOptions ignore_range_deletions;
+  ignore_range_deletions.ignore_range_deletions = true;
+  for (int i = 0; i < 2; ++i) {
+    std::string value;
+    ASSERT_OK(db_->Get(ignore_range_deletions, "foo", &value));
+    ASSERT_EQ(value, "v1");
+  }
+  ASSERT_EQ(Hits(), 0);
+  ASSERT_EQ(Misses(), 0);
+
+  ASSERT_EQ(Get("foo"), "NOT_FOUND");
+  ASSERT_EQ(Get("foo"), "NOT_FOUND");
+  ASSERT_EQ(Hits(), 1);
+}
+
+TEST_F(DBHotRowCacheTest, FIFOCompactionDropsFiles) {
+  Options options = GetHotRowCacheOptions();
+  options.compaction_style = kCompactionStyleFIFO;
+  options.compaction_options_fifo.max_table_files_size = 150 << 10;
+  Open(options);
+
+  Random rnd(301);
+  ASSERT_OK(Put("foo", "v1"));
+  ASSERT_OK(Put("filler1", rnd.RandomString(100 << 10)));
+  ASSERT_OK(Flush());
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Hits(), 1);
+
+  // Exceeds the size limit, so the oldest file is dropped
+  ASSERT_OK(Put("filler2", rnd.RandomString(100 << 10)));
+  ASSERT_OK(Flush());
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ(NumTableFilesAtLevel(0), 1);
+
+  ASSERT_EQ(Get("foo"), "NOT_FOUND");
+  ASSERT_EQ(Hits(), 1);
+}
+
+TEST_F(DBHotRowCacheTest, Bypass) {
+  Options options = GetHotRowCacheOptions();
+  Open(options);
+
+  ASSERT_OK(Put("foo", "v1"));
+
+  ReadOptions no_fill;
+  no_fill.fill_cache = false;
+  std::string value;
+  ASSERT_OK(db_->Get(no_fill, "foo", &value));
+  ASSERT_OK(db_->Get(no_fill, "foo", &value));
+  ASSERT_EQ(Hits(), 0);
+
+  // Not supported with a compaction filter
+  options.statistics = CreateDBStatistics();
+  options.compaction_filter_factory =
+      std::make_shared<test::ChanglingCompactionFilterFactory>("dummy");
+  Open(options);
+  ASSERT_OK(Put("foo", "v1"));
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Get("foo"), "v1");
+  ASSERT_EQ(Hits(), 0);
+  ASSERT_EQ(Misses(), 0);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -274,6 +274,24 @@ DBImpl::DBImpl(const DBOptions& options, const std::string& dbname,
   // dealt with
   co.hash_seed = 0;
   table_cache_ = NewLRUCache(co);
+  // With unordered_write, sequence numbers are published before the memtable
+  // insertion that notifies the hot row cache of a write. With seq_per_batch_,
+  // visibility is decided by the transaction layer.
+  if (immutable_db_options_.hot_row_cache &&
+      !immutable_db_options_.unordered_write && !seq_per_batch_) {
+    hot_row_cache_.reset(
+        new HotRowCache(immutable_db_options_.hot_row_cache, stats_));
+  }
+  if (!immutable_db_options_.block_cache_simulation_capacities.empty()) {
+    BlockCacheTraceOptions simulation_options;
+    simulation_options.sampling_frequency =
+        immutable_db_options_.block_cache_simulation_sampling_frequency;
+    block_cache_simulator_.reset(new OnlineCacheSimulator(
+        immutable_db_options_.block_cache_simulation_capacities,
+        simulation_options.sampling_frequency));
+    block_cache_tracer_.SetSimulator(simulation_options,
+                                     block_cache_simulator_.get());
+  }
   SetDbSessionId();
   assert(!db_session_id_.empty());
 
@@ -2302,6 +2320,25 @@ Status DBImpl::GetEntity(const ReadOptions& _read_options, const Slice& key,
   return s;
 }
 
+bool DBImpl::CanUseHotRowCache(const ReadOptions& read_options,
+                               const ColumnFamilyData* cfd) const {
+  if (!hot_row_cache_ || read_options.read_tier != kReadAllTier ||
+      read_options.timestamp != nullptr ||
+      read_options.merge_operand_count_threshold.has_value() ||
+      // Results could include data deleted by range deletions already
+      // accounted for by the cache
+      read_options.ignore_range_deletions) {
+    return false;
+  }
+  assert(cfd);
+  const ImmutableOptions& ioptions = cfd->ioptions();
+  // Compaction filters can change results without going through the write
+  // path.
+  return cfd->user_comparator()->timestamp_size() == 0 &&
+         ioptions.compaction_filter == nullptr &&
+         ioptions.compaction_filter_factory == nullptr;
+}
+
 bool DBImpl::ShouldReferenceSuperVersion(const MergeContext& merge_context) {
   // If both thresholds are reached, a function returning merge operands as
   // `PinnableSlice`s should reference the `SuperVersion` to avoid large and/or
@@ -2385,6 +2422,14 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
     }
   }
 
+  const bool use_hot_row_cache =
+      get_impl_options.get_value && !get_impl_options.callback &&
+      !get_impl_options.is_blob_index && !get_impl_options.value_found &&
+      CanUseHotRowCache(read_options, cfd);
+  // Must be obtained before the SuperVersion; see HotRowCache::Insert()
+  const uint64_t hot_row_cache_gen =
+      use_hot_row_cache ? hot_row_cache_->GetGeneration() : 0;
+
   // Acquire SuperVersion
   SuperVersion* sv = GetAndRefSuperVersion(cfd);
   if (read_options.timestamp && read_options.timestamp->size() > 0) {
@@ -2463,6 +2508,24 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
   LookupKey lkey(key, snapshot, read_options.timestamp);
   PERF_TIMER_STOP(get_snapshot_time);
 
+  if (use_hot_row_cache &&
+      hot_row_cache_->Lookup(cfd->GetID(), key, snapshot,
+                             get_impl_options.value, get_impl_options.columns,
+                             &s)) {
+    RecordTick(stats_, NUMBER_KEYS_READ);
+    size_t size = 0;
+    if (s.ok()) {
+      size = get_impl_options.value
+                 ? get_impl_options.value->size()
+                 : get_impl_options.columns->serialized_size();
+      RecordTick(stats_, BYTES_READ, size);
+      PERF_COUNTER_ADD(get_read_bytes, size);
+    }
+    ReturnAndCleanupSuperVersion(cfd, sv);
+    RecordInHistogram(stats_, BYTES_PER_READ, size);
+    return s;
+  }
+
   bool skip_memtable = (read_options.read_tier == kPersistedTier &&
                         has_unpersisted_data_.load(std::memory_order_relaxed));
   bool done = false;
@@ -2631,6 +2694,11 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
       PERF_COUNTER_ADD(get_read_bytes, size);
     }
 
+    if (use_hot_row_cache && read_options.fill_cache) {
+      hot_row_cache_->Insert(cfd->GetID(), key, snapshot, hot_row_cache_gen, s,
+                             get_impl_options.value, get_impl_options.columns);
+    }
+
     ReturnAndCleanupSuperVersion(cfd, sv);
 
     RecordInHistogram(stats_, BYTES_PER_READ, size);
@@ -2920,6 +2988,8 @@ void DBImpl::MultiGetCommon(const ReadOptions& read_options,
   key_range_per_cf.emplace_back(cf_start, num_keys - cf_start);
   cf_sv_pairs.emplace_back(cf, nullptr);
 
+  const uint64_t hot_row_cache_gen =
+      hot_row_cache_ ? hot_row_cache_->GetGeneration() : 0;
   SequenceNumber consistent_seqnum = kMaxSequenceNumber;
   bool sv_from_thread_local = false;
   Status s = MultiCFSnapshot<autovector<ColumnFamilySuperVersionPair,
@@ -2956,7 +3026,7 @@ void DBImpl::MultiGetCommon(const ReadOptions& read_options,
     s = MultiGetImpl(read_options, key_range_per_cf_iter->start,
                      key_range_per_cf_iter->num_keys, &sorted_keys,
                      cf_sv_pair_iter->super_version, consistent_seqnum,
-                     read_callback);
+                     read_callback, hot_row_cache_gen);
     if (!s.ok()) {
       break;
     }
@@ -3116,6 +3186,8 @@ void DBImpl::MultiGetWithCallbackImpl(
   std::array<ColumnFamilySuperVersionPair, 1> cf_sv_pairs;
   cf_sv_pairs[0] = ColumnFamilySuperVersionPair(column_family, nullptr);
   size_t num_keys = sorted_keys->size();
+  const uint64_t hot_row_cache_gen =
+      hot_row_cache_ ? hot_row_cache_->GetGeneration() : 0;
   SequenceNumber consistent_seqnum = kMaxSequenceNumber;
   bool sv_from_thread_local = false;
   Status s = MultiCFSnapshot<std::array<ColumnFamilySuperVersionPair, 1>>(
@@ -3164,7 +3236,7 @@ void DBImpl::MultiGetWithCallbackImpl(
 
   s = MultiGetImpl(read_options, 0, num_keys, sorted_keys,
                    cf_sv_pairs[0].super_version, consistent_seqnum,
-                   read_callback);
+                   read_callback, hot_row_cache_gen);
   assert(s.ok() || s.IsTimedOut() || s.IsAborted());
   ReturnAndCleanupSuperVersion(cf_sv_pairs[0].cfd,
                                cf_sv_pairs[0].super_version);
@@ -3175,6 +3247,8 @@ void DBImpl::MultiGetWithCallbackImpl(
 // num_keys - Number of keys to lookup, starting with sorted_keys[start_key]
 // sorted_keys - The entire batch of sorted keys for this CF
 //
+// hot_row_cache_gen - HotRowCache generation obtained before super_version
+//
 // The per key status is returned in the KeyContext structures pointed to by
 // sorted_keys. An overall Status is also returned, with the only possible
 // values being Status::OK() and Status::TimedOut(). The latter indicates
@@ -3183,7 +3257,7 @@ Status DBImpl::MultiGetImpl(
     const ReadOptions& read_options, size_t start_key, size_t num_keys,
     autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
     SuperVersion* super_version, SequenceNumber snapshot,
-    ReadCallback* callback) {
+    ReadCallback* callback, uint64_t hot_row_cache_gen) {
   PERF_CPU_TIMER_GUARD(get_cpu_nanos, immutable_db_options_.clock);
   StopWatch sw(immutable_db_options_.clock, stats_, DB_MULTIGET);
 
@@ -3205,6 +3279,9 @@ Status DBImpl::MultiGetImpl(
   size_t keys_left = num_keys;
   Status s;
   uint64_t curr_value_size = 0;
+  const bool use_hot_row_cache =
+      callback == nullptr &&
+      CanUseHotRowCache(read_options, super_version->cfd);
   while (keys_left) {
     if (read_options.deadline.count() &&
         immutable_db_options_.clock->NowMicros() >
@@ -3216,9 +3293,9 @@ Status DBImpl::MultiGetImpl(
     size_t batch_size = (keys_left > MultiGetContext::MAX_BATCH_SIZE)
                             ? MultiGetContext::MAX_BATCH_SIZE
                             : keys_left;
-    MultiGetContext ctx(sorted_keys, start_key + num_keys - keys_left,
-                        batch_size, snapshot, read_options, GetFileSystem(),
-                        stats_);
+    const size_t batch_start = start_key + num_keys - keys_left;
+    MultiGetContext ctx(sorted_keys, batch_start, batch_size, snapshot,
+                        read_options, GetFileSystem(), stats_);
     MultiGetRange range = ctx.GetMultiGetRange();
     range.AddValueSize(curr_value_size);
     bool lookup_current = true;
@@ -3230,6 +3307,24 @@ Status DBImpl::MultiGetImpl(
       *mget_iter->s = Status::OK();
     }
 
+    MultiGetContext::Mask hot_row_cache_hits = 0;
+    if (use_hot_row_cache) {
+      for (auto mget_iter = range.begin(); mget_iter != range.end();
+           ++mget_iter) {
+        if (hot_row_cache_->Lookup(super_version->cfd->GetID(),
+                                   *mget_iter->key, snapshot, mget_iter->value,
+                                   mget_iter->columns, mget_iter->s)) {
+          hot_row_cache_hits |= MultiGetContext::Mask{1} << mget_iter.index();
+          if (mget_iter->s->ok()) {
+            range.AddValueSize(mget_iter->value
+                                   ? mget_iter->value->size()
+                                   : mget_iter->columns->serialized_size());
+          }
+          range.MarkKeyDone(mget_iter);
+        }
+      }
+    }
+
     bool skip_memtable =
         (read_options.read_tier == kPersistedTier &&
          has_unpersisted_data_.load(std::memory_order_relaxed));
@@ -3250,6 +3345,17 @@ Status DBImpl::MultiGetImpl(
       PERF_TIMER_GUARD(get_from_output_files_time);
       super_version->current->MultiGet(read_options, &range, callback);
     }
+    if (use_hot_row_cache && read_options.fill_cache) {
+      for (size_t i = 0; i < batch_size; ++i) {
+        if (hot_row_cache_hits & (MultiGetContext::Mask{1} << i)) {
+          continue;
+        }
+        KeyContext* kctx = (*sorted_keys)[batch_start + i];
+        hot_row_cache_->Insert(super_version->cfd->GetID(), *kctx->key,
+                               snapshot, hot_row_cache_gen, *kctx->s,
+                               kctx->value, kctx->columns);
+      }
+    }
     curr_value_size = range.GetValueSize();
     if (curr_value_size > read_options.value_size_soft_limit) {
       s = Status::Aborted();
@@ -4624,6 +4730,15 @@ bool DBImpl::GetPropertyHandleOptionsStatistics(std::string* value) {
   return true;
 }
 
+bool DBImpl::GetPropertyHandleBlockCacheSimulation(std::string* value) {
+  assert(value != nullptr);
+  if (!block_cache_simulator_) {
+    return false;
+  }
+  *value = block_cache_simulator_->ToString();
+  return true;
+}
+
 Status DBImpl::ResetStats() {
   InstrumentedMutexLock l(&mutex_);
   for (auto* cfd : *versions_->GetColumnFamilySet()) {
@@ -4980,6 +5095,9 @@ Status DBImpl::DeleteFilesInRanges(ColumnFamilyHandle* column_family,
     if (status.ok()) {
       InstallSuperVersionAndScheduleWork(
           cfd, job_context.superversion_contexts.data());
+      if (hot_row_cache_) {
+        hot_row_cache_->InvalidateAll();
+      }
     }
     for (auto* deleted_file : deleted_files) {
       deleted_file->being_compacted = false;
@@ -6085,6 +6203,10 @@ Status DBImpl::IngestExternalFiles(
         }
 #endif  // !NDEBUG
       }
+      if (hot_row_cache_) {
+        // Ingested keys do not go through the memtable
+        hot_row_cache_->InvalidateAll();
+      }
     } else if (versions_->io_status().IsIOError()) {
       // Error while writing to MANIFEST.
       // In fact, versions_->io_status() can also be the result of renaming
@@ -29,6 +29,7 @@
 #include "db/external_sst_file_ingestion_job.h"
 #include "db/flush_job.h"
 #include "db/flush_scheduler.h"
+#include "db/hot_row_cache.h"
 #include "db/import_column_family_job.h"
 #include "db/internal_stats.h"
 #include "db/log_writer.h"
@@ -69,6 +70,7 @@
 #include "util/repeatable_thread.h"
 #include "util/stop_watch.h"
 #include "util/thread_local.h"
+#include "utilities/simulator_cache/cache_simulator.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -1084,6 +1086,9 @@ class DBImpl : public DB {
 
   InstrumentedMutex* mutex() const { return &mutex_; }
 
+  // nullptr if DBOptions::hot_row_cache is not set or not supported
+  HotRowCache* hot_row_cache() const { return hot_row_cache_.get(); }
+
   // Initialize a brand new DB. The DB directory is expected to be empty before
   // calling it. Push new manifest file name into `new_filenames`.
   Status NewDB(std::vector<std::string>* new_filenames);
@@ -1369,6 +1374,9 @@ class DBImpl : public DB {
       recovered_transactions_;
   std::unique_ptr<Tracer> tracer_;
   InstrumentedMutex trace_mutex_;
+  // See DBOptions::block_cache_simulation_capacities. Declared before
+  // block_cache_tracer_, which refers to it, so that it is destroyed after.
+  std::unique_ptr<OnlineCacheSimulator> block_cache_simulator_;
   BlockCacheTracer block_cache_tracer_;
 
   // constant false canceled flag, used when the compaction is not manual
@@ -1390,6 +1398,9 @@ class DBImpl : public DB {
   // table_cache_ provides its own synchronization
   std::shared_ptr<Cache> table_cache_;
 
+  // Provides its own synchronization; see DBOptions::hot_row_cache
+  std::unique_ptr<HotRowCache> hot_row_cache_;
+
   ErrorHandler error_handler_;
 
   // Unified interface for logging events
@@ -2528,6 +2539,8 @@ class DBImpl : public DB {
                               bool is_locked, uint64_t* value);
   bool GetPropertyHandleOptionsStatistics(std::string* value);
 
+  bool GetPropertyHandleBlockCacheSimulation(std::string* value);
+
   bool HasPendingManualCompaction();
   bool HasExclusiveManualCompaction();
   void AddManualCompaction(ManualCompactionState* m);
@@ -2664,7 +2677,14 @@ class DBImpl : public DB {
   Status MultiGetImpl(
       const ReadOptions& read_options, size_t start_key, size_t num_keys,
       autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
-      SuperVersion* sv, SequenceNumber snap_seqnum, ReadCallback* callback);
+      SuperVersion* sv, SequenceNumber snap_seqnum, ReadCallback* callback,
+      uint64_t hot_row_cache_gen);
+
+  // Whether results of point lookups with `read_options` on `cfd` can be
+  // served from / inserted into hot_row_cache_. Callers must additionally
+  // exclude reads with a ReadCallback.
+  bool CanUseHotRowCache(const ReadOptions& read_options,
+                         const ColumnFamilyData* cfd) const;
 
   void MultiGetWithCallbackImpl(
       const ReadOptions& read_options, ColumnFamilyHandle* column_family,
@@ -3781,6 +3781,10 @@ Status DBImpl::BackgroundCompaction(bool* made_progress,
                      c->num_input_files(0));
     if (status.ok() && io_s.ok()) {
       UpdateDeletionCompactionStats(c);
+      if (hot_row_cache_) {
+        // Data was dropped without going through the memtable
+        hot_row_cache_->InvalidateAll();
+      }
     }
     *made_progress = true;
     TEST_SYNC_POINT_CALLBACK("DBImpl::BackgroundCompaction:AfterCompaction",
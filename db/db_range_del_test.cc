@@ -3149,6 +3149,90 @@ TEST_F(DBRangeDelTest, RangetombesoneCompensateFilesizePersistDuringReopen) {
   ASSERT_EQ(level_to_files[1][0].compensated_range_deletion_size, l2_size);
 }
 
+TEST_F(DBRangeDelTest, RangeDeletionCompactionTriggerRatio) {
+  Options opts = CurrentOptions();
+  opts.num_levels = 4;
+  opts.level_compaction_dynamic_level_bytes = false;
+  DestroyAndReopen(opts);
+
+  Random rnd(301);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(1 << 10)));
+  }
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(3);
+
+  // A range tombstone covering much more data than the size of its file
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                             Key(0), Key(100)));
+  ASSERT_OK(Flush());
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ("1,0,0,1", FilesPerLevel());
+
+  // The tombstone is compacted down level by level until it reaches the
+  // covered data, which is dropped
+  ASSERT_OK(dbfull()->SetOptions(
+      {{"range_deletion_compaction_trigger_ratio", "1.0"}}));
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ("", FilesPerLevel());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ("NOT_FOUND", Get(Key(i)));
+  }
+}
+
+TEST_F(DBRangeDelTest, CompactionSkipsFilesCoveredByStandaloneRangeDeletion) {
+  Options opts = CurrentOptions();
+  opts.num_levels = 4;
+  opts.level_compaction_dynamic_level_bytes = false;
+
+  for (bool with_snapshot : {false, true}) {
+    DestroyAndReopen(opts);
+    Random rnd(301);
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_OK(Put(Key(i), rnd.RandomString(1 << 10)));
+    }
+    ASSERT_OK(Flush());
+    MoveFilesToLevel(3);
+    std::vector<std::vector<FileMetaData>> level_to_files;
+    dbfull()->TEST_GetFilesMetaData(dbfull()->DefaultColumnFamily(),
+                                    &level_to_files);
+    ASSERT_EQ(level_to_files[3].size(), 1);
+    uint64_t l3_file_size = level_to_files[3][0].fd.GetFileSize();
+
+    const Snapshot* snapshot = with_snapshot ? db_->GetSnapshot() : nullptr;
+    // A file with just a range tombstone covering the whole L3 file
+    ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                               Key(0), Key(100)));
+    ASSERT_OK(Flush());
+    MoveFilesToLevel(2);
+    ASSERT_EQ("0,0,1,1", FilesPerLevel());
+
+    ASSERT_OK(dbfull()->SetOptions(
+        {{"range_deletion_compaction_trigger_ratio", "1.0"}}));
+    ASSERT_OK(dbfull()->TEST_WaitForCompact());
+    ColumnFamilyData* cfd = static_cast<ColumnFamilyHandleImpl*>(
+                                dbfull()->DefaultColumnFamily())
+                                ->cfd();
+    const InternalStats::CompactionStats& l3_stats =
+        cfd->internal_stats()->TEST_GetCompactionStats()[3];
+    if (with_snapshot) {
+      // The covered data is still visible to the snapshot, so it is compacted
+      // as usual
+      ASSERT_EQ(1, l3_stats.num_input_files_in_output_level);
+      ASSERT_EQ(0, l3_stats.num_filtered_input_files_in_output_level);
+      ASSERT_EQ(1 << 10, Get(Key(0), snapshot).size());
+      db_->ReleaseSnapshot(snapshot);
+    } else {
+      // The covered L3 file is dropped without being read
+      ASSERT_EQ(0, l3_stats.num_input_files_in_output_level);
+      ASSERT_EQ(1, l3_stats.num_filtered_input_files_in_output_level);
+      ASSERT_EQ(l3_file_size, l3_stats.bytes_skipped_output_level);
+      ASSERT_EQ("", FilesPerLevel());
+    }
+    ASSERT_EQ("NOT_FOUND", Get(Key(0)));
+  }
+}
+
 TEST_F(DBRangeDelTest, SingleKeyFile) {
   // Test for a bug fix where a range tombstone could be added
   // to an SST file while is not within the file's key range.
@@ -0,0 +1,167 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "db/hot_row_cache.h"
+
+#include "db/wide/wide_column_serialization.h"
+#include "monitoring/statistics_impl.h"
+#include "util/coding.h"
+#include "util/hash.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+HotRowCache::HotRowCache(std::shared_ptr<RowCache> cache, Statistics* stats)
+    : cache_(std::move(cache)),
+      stats_(stats),
+      stripes_(new RelaxedAtomic<SequenceNumber>[size_t{1}
+                                                 << kNumStripeBits]) {
+  assert(cache_);
+  PutVarint64(&cache_id_, cache_.get()->NewId());
+}
+
+uint32_t HotRowCache::GetStripe(uint32_t cf_id, const Slice& user_key) {
+  const uint64_t h = GetSliceNPHash64(user_key, cf_id);
+  return static_cast<uint32_t>(h >> (64 - kNumStripeBits));
+}
+
+void HotRowCache::MakeKey(uint32_t cf_id, const Slice& user_key,
+                          std::string* key) const {
+  key->reserve(cache_id_.size() + kMaxVarint64Length + user_key.size());
+  key->assign(cache_id_);
+  PutVarint32(key, cf_id);
+  key->append(user_key.data(), user_key.size());
+}
+
+bool HotRowCache::IsValid(const Entry& entry, uint32_t stripe,
+                          SequenceNumber read_seq) const {
+  // An entry produced by a later read could reflect writes not visible to
+  // this read.
+  if (entry.read_seq > read_seq) {
+    return false;
+  }
+  if (entry.generation != generation_.Load()) {
+    return false;
+  }
+  // Any write to the key (or a key sharing its stripe) after the entry was
+  // produced means the entry might be stale for reads at `read_seq`.
+  return stripes_[stripe].LoadRelaxed() <= entry.read_seq &&
+         range_write_seq_.LoadRelaxed() <= entry.read_seq;
+}
+
+bool HotRowCache::Lookup(uint32_t cf_id, const Slice& user_key,
+                         SequenceNumber read_seq, PinnableSlice* value,
+                         PinnableWideColumns* columns, Status* s) {
+  assert((value == nullptr) != (columns == nullptr));
+  assert(s);
+
+  std::string key;
+  MakeKey(cf_id, user_key, &key);
+  TypedHandle* handle = cache_.Lookup(key);
+  if (handle == nullptr) {
+    RecordTick(stats_, HOT_ROW_CACHE_MISS);
+    return false;
+  }
+
+  const Entry* entry = cache_.Value(handle);
+  assert(entry);
+  if (!IsValid(*entry, GetStripe(cf_id, user_key), read_seq) ||
+      (columns != nullptr && entry->kind == EntryKind::kPlainValue)) {
+    cache_.Release(handle);
+    RecordTick(stats_, HOT_ROW_CACHE_MISS);
+    return false;
+  }
+
+  Status hit_status;
+  switch (entry->kind) {
+    case EntryKind::kNotFound:
+      cache_.Release(handle);
+      hit_status = Status::NotFound();
+      break;
+    case EntryKind::kPlainValue:
+      assert(value);
+      value->PinSlice(entry->payload, nullptr);
+      cache_.RegisterReleaseAsCleanup(handle, *value);
+      break;
+    case EntryKind::kEntity:
+      if (value) {
+        Slice entity(entry->payload);
+        Slice default_value;
+        hit_status = WideColumnSerialization::GetValueOfDefaultColumn(
+            entity, default_value);
+        if (hit_status.ok()) {
+          value->PinSlice(default_value, nullptr);
+          cache_.RegisterReleaseAsCleanup(handle, *value);
+        } else {
+          cache_.Release(handle);
+        }
+      } else {
+        // Keep the handle referenced until the columns are reset
+        Cleanable cleanable;
+        cache_.RegisterReleaseAsCleanup(handle, cleanable);
+        hit_status = columns->SetWideColumnValue(entry->payload, &cleanable);
+      }
+      break;
+  }
+
+  if (!hit_status.ok() && !hit_status.IsNotFound()) {
+    // Should not happen as entities are validated before insertion; fall
+    // back to a regular lookup.
+    assert(false);
+    if (value) {
+      value->Reset();
+    } else {
+      columns->Reset();
+    }
+    RecordTick(stats_, HOT_ROW_CACHE_MISS);
+    return false;
+  }
+
+  RecordTick(stats_, HOT_ROW_CACHE_HIT);
+  *s = hit_status;
+  return true;
+}
+
+void HotRowCache::Insert(uint32_t cf_id, const Slice& user_key,
+                         SequenceNumber read_seq, uint64_t generation,
+                         const Status& s, const PinnableSlice* value,
+                         const PinnableWideColumns* columns) {
+  assert((value == nullptr) != (columns == nullptr));
+
+  std::unique_ptr<Entry> entry(new Entry);
+  entry->read_seq = read_seq;
+  entry->generation = generation;
+  if (s.IsNotFound()) {
+    entry->kind = EntryKind::kNotFound;
+  } else if (s.ok() && s.subcode() == Status::kNone) {
+    if (value) {
+      entry->kind = EntryKind::kPlainValue;
+      entry->payload.assign(value->data(), value->size());
+    } else {
+      // Entities are stored in serialized form; a plain value read via
+      // GetEntity() becomes an entity with a single default column, which is
+      // exactly what GetEntity() returns for it.
+      entry->kind = EntryKind::kEntity;
+      if (!WideColumnSerialization::Serialize(columns->columns(),
+                                              entry->payload)
+               .ok()) {
+        return;
+      }
+    }
+  } else {
+    return;
+  }
+
+  std::string key;
+  MakeKey(cf_id, user_key, &key);
+  const size_t charge = sizeof(Entry) + entry->payload.capacity() + key.size();
+  const Status cs = cache_.Insert(key, entry.get(), charge);
+  if (cs.ok()) {
+    entry.release();
+  }
+  // Otherwise (e.g. cache is full with strict capacity limit) we keep
+  // ownership of entry, and the result is simply not cached.
+}
+
+}  // namespace ROCKSDB_NAMESPACE
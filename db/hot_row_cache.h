@@ -0,0 +1,132 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "cache/typed_cache.h"
+#include "db/dbformat.h"
+#include "rocksdb/cache.h"
+#include "rocksdb/slice.h"
+#include "rocksdb/status.h"
+#include "rocksdb/wide_columns.h"
+#include "util/atomic.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+class Statistics;
+
+// A DB-level cache of point lookup results, keyed by column family ID and
+// user key (see `DBOptions::hot_row_cache`). Unlike the table-level row cache,
+// an entry holds the final result of a lookup (value, entity, or not found),
+// so a hit skips the memtables, filters, and indexes altogether.
+//
+// Correctness is maintained without erasing entries on the write path. Each
+// entry records the sequence number of the read that produced it. The write
+// path (memtable insertion) records, in a fixed-size table of stripes hashed
+// by column family and key, the largest sequence number written to any key
+// mapping to the stripe. An entry is only served to a read at sequence number
+// `S` if it was produced at `S' <= S` and no write to its stripe has happened
+// after `S'`, i.e. the key's value cannot have changed in between. Range
+// deletions conservatively count as a write to every key. Operations that
+// change the visible data without going through the memtable (e.g. file
+// ingestion, or FIFO compaction dropping files) bump a generation number that
+// invalidates all prior entries.
+//
+// Thread-safe (provides internal synchronization)
+class HotRowCache {
+ public:
+  HotRowCache(std::shared_ptr<RowCache> cache, Statistics* stats);
+
+  // No copying allowed
+  HotRowCache(const HotRowCache&) = delete;
+  HotRowCache& operator=(const HotRowCache&) = delete;
+
+  // Write path: record a write to `user_key` in `cf_id` at `seq`. Must be
+  // called before the write is published to readers.
+  void NoteKeyWrite(uint32_t cf_id, const Slice& user_key,
+                    SequenceNumber seq) {
+    FetchMax(stripes_[GetStripe(cf_id, user_key)], seq);
+  }
+
+  // Write path: record a write that potentially affects every key (e.g. a
+  // range deletion) at `seq`.
+  void NoteRangeWrite(SequenceNumber seq) { FetchMax(range_write_seq_, seq); }
+
+  // Invalidate all entries currently in the cache. Used for changes to the
+  // visible data that do not go through the memtable. Must be called after
+  // such a change has been installed.
+  void InvalidateAll() { generation_.FetchAdd(1); }
+
+  // Read path: must be called before acquiring the SuperVersion used for the
+  // read whose result is later passed to `Insert()`.
+  uint64_t GetGeneration() const { return generation_.Load(); }
+
+  // Read path: look up the result of reading `user_key` from `cf_id` at
+  // `read_seq`. On a hit, fills either `value` or `columns` (exactly one of
+  // which must be non-null), sets `*s` to OK or NotFound, and returns true.
+  // A hit on a plain value result cannot be returned to an entity lookup, as
+  // the value might be the default column of an entity.
+  bool Lookup(uint32_t cf_id, const Slice& user_key, SequenceNumber read_seq,
+              PinnableSlice* value, PinnableWideColumns* columns, Status* s);
+
+  // Read path: insert the result of reading `user_key` from `cf_id` at
+  // `read_seq`, where `generation` was obtained before the read started.
+  // Results other than OK and NotFound are ignored.
+  void Insert(uint32_t cf_id, const Slice& user_key, SequenceNumber read_seq,
+              uint64_t generation, const Status& s, const PinnableSlice* value,
+              const PinnableWideColumns* columns);
+
+  // Number of stripes used for tracking writes. Keys hashing to the same
+  // stripe invalidate each other's entries.
+  static constexpr uint32_t kNumStripeBits = 14;
+
+ private:
+  enum class EntryKind : uint8_t {
+    kNotFound,
+    // Result of a Get(); only servable to Get()
+    kPlainValue,
+    // Result of a GetEntity(); servable to both Get() and GetEntity()
+    kEntity,
+  };
+
+  struct Entry {
+    SequenceNumber read_seq;
+    uint64_t generation;
+    EntryKind kind;
+    std::string payload;
+  };
+
+  using CacheInterface =
+      BasicTypedSharedCacheInterface<Entry, CacheEntryRole::kMisc>;
+  using TypedHandle = CacheInterface::TypedHandle;
+
+  static void FetchMax(RelaxedAtomic<SequenceNumber>& atomic,
+                       SequenceNumber seq) {
+    SequenceNumber cur = atomic.LoadRelaxed();
+    while (cur < seq && !atomic.CasWeakRelaxed(cur, seq)) {
+    }
+  }
+
+  static uint32_t GetStripe(uint32_t cf_id, const Slice& user_key);
+
+  void MakeKey(uint32_t cf_id, const Slice& user_key, std::string* key) const;
+
+  bool IsValid(const Entry& entry, uint32_t stripe,
+               SequenceNumber read_seq) const;
+
+  CacheInterface cache_;
+  Statistics* const stats_;
+  // Unique prefix for this DB instance's keys in a potentially shared cache
+  std::string cache_id_;
+  std::unique_ptr<RelaxedAtomic<SequenceNumber>[]> stripes_;
+  RelaxedAtomic<SequenceNumber> range_write_seq_{0};
+  AcqRelAtomic<uint64_t> generation_{0};
+};
+
+}  // namespace ROCKSDB_NAMESPACE
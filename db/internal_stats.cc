@@ -310,6 +310,7 @@ static const std::string block_cache_capacity = "block-cache-capacity";
 static const std::string block_cache_usage = "block-cache-usage";
 static const std::string block_cache_pinned_usage = "block-cache-pinned-usage";
 static const std::string options_statistics = "options-statistics";
+static const std::string block_cache_simulation = "block-cache-simulation";
 static const std::string num_blob_files = "num-blob-files";
 static const std::string blob_stats = "blob-stats";
 static const std::string total_blob_file_size = "total-blob-file-size";
@@ -418,6 +419,8 @@ const std::string DB::Properties::kBlockCachePinnedUsage =
     rocksdb_prefix + block_cache_pinned_usage;
 const std::string DB::Properties::kOptionsStatistics =
     rocksdb_prefix + options_statistics;
+const std::string DB::Properties::kBlockCacheSimulation =
+    rocksdb_prefix + block_cache_simulation;
 const std::string DB::Properties::kLiveSstFilesSizeAtTemperature =
     rocksdb_prefix + live_sst_files_size_at_temperature;
 const std::string DB::Properties::kNumBlobFiles =
@@ -601,6 +604,9 @@ const UnorderedMap<std::string, DBPropertyInfo>
         {DB::Properties::kOptionsStatistics,
          {true, nullptr, nullptr, nullptr,
           &DBImpl::GetPropertyHandleOptionsStatistics}},
+        {DB::Properties::kBlockCacheSimulation,
+         {true, nullptr, nullptr, nullptr,
+          &DBImpl::GetPropertyHandleBlockCacheSimulation}},
         {DB::Properties::kNumBlobFiles,
          {false, nullptr, &InternalStats::HandleNumBlobFiles, nullptr,
           nullptr}},
@@ -9,6 +9,8 @@
 
 #include "db/version_edit.h"
 
+#include <cmath>
+
 #include "db/blob/blob_index.h"
 #include "db/version_set.h"
 #include "logging/event_logger.h"
@@ -27,6 +29,26 @@ uint64_t PackFileNumberAndPathId(uint64_t number, uint64_t path_id) {
   return number | (path_id * (kFileNumberMask + 1));
 }
 
+double FileSampledStats::UpdateReadHeat(uint64_t now,
+                                        uint64_t half_life) const {
+  const uint64_t num_reads = num_reads_sampled.load(std::memory_order_relaxed);
+  if (half_life == 0 || read_heat_update_time == 0) {
+    read_heat = static_cast<double>(num_reads);
+  } else {
+    if (now > read_heat_update_time) {
+      read_heat *= std::exp2(-static_cast<double>(now - read_heat_update_time) /
+                             static_cast<double>(half_life));
+    }
+    if (num_reads > num_reads_at_read_heat_update) {
+      read_heat +=
+          static_cast<double>(num_reads - num_reads_at_read_heat_update);
+    }
+  }
+  num_reads_at_read_heat_update = num_reads;
+  read_heat_update_time = std::max(now, read_heat_update_time);
+  return read_heat;
+}
+
 Status FileMetaData::UpdateBoundaries(const Slice& key, const Slice& value,
                                       SequenceNumber seqno,
                                       ValueType value_type) {
@@ -168,11 +168,26 @@ struct FileSampledStats {
   FileSampledStats(const FileSampledStats& other) { *this = other; }
   FileSampledStats& operator=(const FileSampledStats& other) {
     num_reads_sampled = other.num_reads_sampled.load();
+    read_heat = other.read_heat;
+    num_reads_at_read_heat_update = other.num_reads_at_read_heat_update;
+    read_heat_update_time = other.read_heat_update_time;
     return *this;
   }
 
+  // Decays the read heat by the time passed since its last update, with the
+  // given half-life in seconds, adds the reads sampled since, and returns it.
+  // With a half-life of 0 the read heat is the number of reads sampled.
+  double UpdateReadHeat(uint64_t now, uint64_t half_life) const;
+
   // number of user reads to this file.
   mutable std::atomic<uint64_t> num_reads_sampled;
+
+  // Number of user reads to this file, decayed over time. Only maintained
+  // by UpdateReadHeat() when files are ordered for compaction, which is not
+  // done concurrently.
+  mutable double read_heat = 0;
+  mutable uint64_t num_reads_at_read_heat_update = 0;
+  mutable uint64_t read_heat_update_time = 0;
 };
 
 struct FileMetaData {
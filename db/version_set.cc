@@ -3419,6 +3419,29 @@ bool ShouldChangeFileTemperature(const ImmutableOptions& ioptions,
   }
   return false;
 }
+
+// Returns the number of sorted runs in L0. With leveled compaction, L0 files
+// with the same epoch number are written by the same intra-L0 compaction
+// (see `intra_l0_compaction_output_file_size`) and do not overlap, so they
+// count as one sorted run.
+int NumL0SortedRuns(CompactionStyle compaction_style,
+                    const std::vector<FileMetaData*>& l0_files,
+                    bool skip_being_compacted) {
+  int num_sorted_runs = 0;
+  const FileMetaData* prev = nullptr;
+  for (const FileMetaData* f : l0_files) {
+    if (skip_being_compacted && f->being_compacted) {
+      continue;
+    }
+    if (compaction_style != kCompactionStyleLevel || prev == nullptr ||
+        f->epoch_number == kUnknownEpochNumber ||
+        f->epoch_number != prev->epoch_number) {
+      num_sorted_runs++;
+    }
+    prev = f;
+  }
+  return num_sorted_runs;
+}
 }  // anonymous namespace
 
 void VersionStorageInfo::ComputeCompactionScore(
@@ -3449,13 +3472,13 @@ void VersionStorageInfo::ComputeCompactionScore(
       // file size is small (perhaps because of a small write-buffer
       // setting, or very high compression ratios, or lots of
       // overwrites/deletions).
-      int num_sorted_runs = 0;
+      int num_sorted_runs = NumL0SortedRuns(compaction_style_, files_[level],
+                                            /*skip_being_compacted=*/true);
       uint64_t total_size = 0;
       for (auto* f : files_[level]) {
         total_downcompact_bytes += static_cast<double>(f->fd.GetFileSize());
         if (!f->being_compacted) {
           total_size += f->compensated_file_size;
-          num_sorted_runs++;
         }
       }
       if (compaction_style_ == kCompactionStyleUniversal) {
@@ -3612,7 +3635,11 @@ void VersionStorageInfo::ComputeCompactionScore(
       }
     }
   }
-  ComputeFilesMarkedForCompaction(max_output_level);
+  ComputeFilesMarkedForCompaction(
+      max_output_level,
+      compaction_style_ == kCompactionStyleLevel
+          ? mutable_cf_options.range_deletion_compaction_trigger_ratio
+          : 0);
   ComputeBottommostFilesMarkedForCompaction(
       immutable_options.allow_ingest_behind);
   ComputeExpiredTtlFiles(immutable_options, mutable_cf_options.ttl);
@@ -3627,7 +3654,8 @@ void VersionStorageInfo::ComputeCompactionScore(
   EstimateCompactionBytesNeeded(mutable_cf_options);
 }
 
-void VersionStorageInfo::ComputeFilesMarkedForCompaction(int last_level) {
+void VersionStorageInfo::ComputeFilesMarkedForCompaction(
+    int last_level, double range_deletion_compaction_trigger_ratio) {
   files_marked_for_compaction_.clear();
   int last_qualify_level = 0;
   standalone_range_tombstone_files_mark_threshold_ = kMaxSequenceNumber;
@@ -3644,7 +3672,16 @@ void VersionStorageInfo::ComputeFilesMarkedForCompaction(int last_level) {
 
   for (int level = 0; level <= last_qualify_level; level++) {
     for (auto* f : files_[level]) {
-      if (!f->being_compacted && f->marked_for_compaction) {
+      if (f->being_compacted) {
+        continue;
+      }
+      if (!f->marked_for_compaction &&
+          range_deletion_compaction_trigger_ratio > 0 &&
+          static_cast<double>(f->compensated_range_deletion_size) >
+              range_deletion_compaction_trigger_ratio *
+                  static_cast<double>(f->fd.GetFileSize())) {
+        files_marked_for_compaction_.emplace_back(level, f);
+      } else if (f->marked_for_compaction) {
         files_marked_for_compaction_.emplace_back(level, f);
         if (f->FileIsStandAloneRangeTombstone()) {
           standalone_range_tombstone_files_mark_threshold_ =
@@ -4007,6 +4044,92 @@ void SortFileByOverlappingRatio(
       });
 }
 
+// Sort `temp` by decreasing estimated benefit of compacting a file per byte
+// written by the compaction. See CompactionPri::kMaxBenefitPerCost. In a
+// write burst, files that have not been read recently go last.
+void SortFileByBenefitPerCost(const InternalKeyComparator& icmp,
+                              const std::vector<FileMetaData*>& files,
+                              const std::vector<FileMetaData*>& next_level_files,
+                              SystemClock* clock, bool in_write_burst,
+                              const MutableCFOptions& options,
+                              std::vector<Fsize>* temp) {
+  std::unordered_map<uint64_t, double> file_to_score;
+  std::unordered_map<uint64_t, bool> file_to_hot;
+  auto next_level_it = next_level_files.begin();
+
+  int64_t curr_time;
+  if (!clock->GetCurrentTime(&curr_time).ok()) {
+    // Without the time, reads are not decayed until the next update
+    curr_time = 0;
+  }
+
+  for (auto& file : files) {
+    uint64_t overlapping_bytes = 0;
+    // Skip files in next level that is smaller than current file
+    while (next_level_it != next_level_files.end() &&
+           icmp.Compare((*next_level_it)->largest, file->smallest) < 0) {
+      next_level_it++;
+    }
+
+    while (next_level_it != next_level_files.end() &&
+           icmp.Compare((*next_level_it)->smallest, file->largest) < 0) {
+      overlapping_bytes += (*next_level_it)->fd.file_size;
+
+      if (icmp.Compare((*next_level_it)->largest, file->largest) > 0) {
+        // next level file cross large boundary of current file.
+        break;
+      }
+      next_level_it++;
+    }
+
+    const uint64_t file_size = file->fd.GetFileSize();
+    const double num_reads = file->stats.UpdateReadHeat(
+        static_cast<uint64_t>(curr_time),
+        options.compaction_pri_read_half_life_seconds);
+    const uint64_t reclaimable_bytes =
+        file->compensated_file_size > file_size
+            ? file->compensated_file_size - file_size
+            : 0;
+    const double benefit =
+        static_cast<double>(file_size) +
+        num_reads * static_cast<double>(options.compaction_pri_bytes_per_read) +
+        static_cast<double>(reclaimable_bytes) *
+            options.compaction_pri_space_weight;
+    // Avoid dividing by zero for empty files
+    const uint64_t cost = std::max<uint64_t>(file_size + overlapping_bytes, 1);
+    file_to_score[file->fd.GetNumber()] = benefit / static_cast<double>(cost);
+    // Cold unless at least one read is left after decay
+    file_to_hot[file->fd.GetNumber()] =
+        !in_write_burst || options.compaction_pri_bytes_per_read == 0 ||
+        num_reads >= 1.0;
+  }
+
+  size_t num_to_sort = temp->size() > VersionStorageInfo::kNumberFilesToSort
+                           ? VersionStorageInfo::kNumberFilesToSort
+                           : temp->size();
+
+  std::partial_sort(
+      temp->begin(), temp->begin() + num_to_sort, temp->end(),
+      [&](const Fsize& f1, const Fsize& f2) -> bool {
+        // Same tie breaking as SortFileByOverlappingRatio()
+        if (f1.file->marked_for_compaction != f2.file->marked_for_compaction) {
+          return f1.file->marked_for_compaction >
+                 f2.file->marked_for_compaction;
+        }
+        const bool hot1 = file_to_hot[f1.file->fd.GetNumber()];
+        const bool hot2 = file_to_hot[f2.file->fd.GetNumber()];
+        if (hot1 != hot2) {
+          return hot1;
+        }
+        const double score1 = file_to_score[f1.file->fd.GetNumber()];
+        const double score2 = file_to_score[f2.file->fd.GetNumber()];
+        if (score1 == score2) {
+          return icmp.Compare(f1.file->smallest, f2.file->smallest) < 0;
+        }
+        return score1 > score2;
+      });
+}
+
 void SortFileByRoundRobin(const InternalKeyComparator& icmp,
                           std::vector<InternalKey>* compact_cursor,
                           bool level0_non_overlapping, int level,
@@ -4117,6 +4240,13 @@ void VersionStorageInfo::UpdateFilesByCompactionPri(
         SortFileByRoundRobin(*internal_comparator_, &compact_cursor_,
                              level0_non_overlapping_, level, &temp);
         break;
+      case kMaxBenefitPerCost:
+        SortFileByBenefitPerCost(
+            *internal_comparator_, files_[level], files_[level + 1],
+            ioptions.clock,
+            l0_delay_trigger_count_ >= options.level0_slowdown_writes_trigger,
+            options, &temp);
+        break;
       default:
         assert(false);
     }
@@ -4684,7 +4814,8 @@ void VersionStorageInfo::CalculateBaseBytes(const ImmutableOptions& ioptions,
                                             const MutableCFOptions& options) {
   // Special logic to set number of sorted runs.
   // It is to match the previous behavior when all files are in L0.
-  int num_l0_count = static_cast<int>(files_[0].size());
+  int num_l0_count = NumL0SortedRuns(compaction_style_, files_[0],
+                                     /*skip_being_compacted=*/false);
   if (compaction_style_ == kCompactionStyleUniversal) {
     // For universal compaction, we use level0 score to indicate
     // compaction score for the whole DB. Adding other levels as if
@@ -207,8 +207,12 @@ class VersionStorageInfo {
       const MutableCFOptions& mutable_cf_options);
 
   // This computes files_marked_for_compaction_ and is called by
-  // ComputeCompactionScore()
-  void ComputeFilesMarkedForCompaction(int last_level);
+  // ComputeCompactionScore(). Besides the files marked by the user or table
+  // properties collectors, it includes the files whose range tombstones cover
+  // lower-level data of more than `range_deletion_compaction_trigger_ratio`
+  // times their own size.
+  void ComputeFilesMarkedForCompaction(
+      int last_level, double range_deletion_compaction_trigger_ratio);
 
   // This computes ttl_expired_files_ and is called by
   // ComputeCompactionScore()
@@ -2063,6 +2063,24 @@ class MemTableInserter : public WriteBatch::Handler {
     prot_info_ = nullptr;
   }
 
+  // Must precede the memtable insertion of the write to `key`, so that the
+  // write is accounted for before it becomes visible to readers.
+  void NoteHotRowWrite(uint32_t column_family_id, const Slice& key,
+                       ValueType value_type) {
+    if (db_ == nullptr) {
+      return;
+    }
+    HotRowCache* const hot_row_cache = db_->hot_row_cache();
+    if (hot_row_cache == nullptr) {
+      return;
+    }
+    if (value_type == kTypeRangeDeletion) {
+      hot_row_cache->NoteRangeWrite(sequence_);
+    } else {
+      hot_row_cache->NoteKeyWrite(column_family_id, key, sequence_);
+    }
+  }
+
  protected:
   Handler::OptionState WriteBeforePrepare() const override {
     return write_before_prepare_ ? Handler::OptionState::kEnabled
@@ -2240,6 +2258,8 @@ class MemTableInserter : public WriteBatch::Handler {
     }
     assert(ret_status.ok());
 
+    NoteHotRowWrite(column_family_id, key, value_type);
+
     MemTable* mem = cf_mems_->GetMemTable();
     auto* moptions = mem->GetImmutableMemTableOptions();
     // inplace_update_support is inconsistent with snapshots, and therefore with
@@ -2461,9 +2481,11 @@ class MemTableInserter : public WriteBatch::Handler {
     return s;
   }
 
-  Status DeleteImpl(uint32_t /*column_family_id*/, const Slice& key,
+  Status DeleteImpl(uint32_t column_family_id, const Slice& key,
                     const Slice& value, ValueType delete_type,
                     const ProtectionInfoKVOS64* kv_prot_info) {
+    NoteHotRowWrite(column_family_id, key, delete_type);
+
     Status ret_status;
     MemTable* mem = cf_mems_->GetMemTable();
     ret_status =
@@ -2725,6 +2747,8 @@ class MemTableInserter : public WriteBatch::Handler {
     }
     assert(ret_status.ok());
 
+    NoteHotRowWrite(column_family_id, key, kTypeMerge);
+
     MemTable* mem = cf_mems_->GetMemTable();
     auto* moptions = mem->GetImmutableMemTableOptions();
     if (moptions->merge_operator == nullptr) {
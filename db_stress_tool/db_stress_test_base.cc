@@ -3325,6 +3325,9 @@ void StressTest::PrintEnv() const {
     case kRoundRobin:
       compaction_pri = "kRoundRobin";
       break;
+    case kMaxBenefitPerCost:
+      compaction_pri = "kMaxBenefitPerCost";
+      break;
   }
   fprintf(stdout, "Compaction Pri            : %s\n", compaction_pri);
   fprintf(stdout, "Background Purge          : %d\n",
@@ -59,6 +59,25 @@ enum CompactionPri : char {
   // level. The file picking process will cycle through all the files in a
   // round-robin manner.
   kRoundRobin = 0x4,
+  // EXPERIMENTAL
+  // First compact files with the highest estimated benefit per byte written
+  // by the compaction. As in kMinOverlappingRatio, the bytes written are
+  // estimated as the size of the file plus the size of the overlapping files
+  // in the next level. The benefit adds up
+  // - the size of the file, i.e. the data moved to the next level,
+  // - the reads sampled on the file, which no longer need to consult both
+  //   levels, decayed over `compaction_pri_read_half_life_seconds` and
+  //   weighted by `compaction_pri_bytes_per_read`, and
+  // - the size compensation of the file for deletions and range deletions
+  //   (i.e. the space they are estimated to reclaim), weighted by
+  //   `compaction_pri_space_weight`.
+  // With both weights set to 0, this orders files by overlapping ratio like
+  // kMinOverlappingRatio, without its size compensation and TTL boosting.
+  // Files marked for compaction will be prioritized over files that are not
+  // marked. During write bursts, i.e. while L0 has reached
+  // `level0_slowdown_writes_trigger` files, files that have not been read
+  // recently are compacted after those that have.
+  kMaxBenefitPerCost = 0x5,
 };
 
 struct FileTemperatureAge {
@@ -595,6 +614,66 @@ struct AdvancedColumnFamilyOptions {
   // Default: kMinOverlappingRatio
   CompactionPri compaction_pri = kMinOverlappingRatio;
 
+  // Only used with `compaction_pri = kMaxBenefitPerCost`: how many bytes of
+  // compaction writes are worth saving one read of a file.
+  //
+  // Default: 4096
+  //
+  // Dynamically changeable through SetOptions() API
+  uint64_t compaction_pri_bytes_per_read = 4096;
+
+  // Only used with `compaction_pri = kMaxBenefitPerCost`: how many bytes of
+  // compaction writes are worth reclaiming one byte of space from deleted
+  // data.
+  //
+  // Default: 1.0
+  //
+  // Dynamically changeable through SetOptions() API
+  double compaction_pri_space_weight = 1.0;
+
+  // Only used with `compaction_pri = kMaxBenefitPerCost`: the half-life in
+  // seconds of the read count of a file, so that the files read recently
+  // count as hot rather than those read a lot since they were created. 0
+  // means reads never decay.
+  //
+  // Default: 3600 (1 hour)
+  //
+  // Dynamically changeable through SetOptions() API
+  uint64_t compaction_pri_read_half_life_seconds = 3600;
+
+  // EXPERIMENTAL
+  // Only used with `compaction_style = kCompactionStyleLevel`. If non-zero,
+  // compactions from L0 to L0 (e.g. picked while L0->Lbase compaction cannot
+  // keep up with a write burst) write their output as key-partitioned L0
+  // files of about this size instead of a single file. The output is also
+  // split where the `sst_partitioner_factory` requires it, and only between
+  // user keys. L0 files written by the same compaction do not overlap, so
+  // they count as one sorted run towards `level0_file_num_compaction_trigger`,
+  // `level0_slowdown_writes_trigger` and `level0_stop_writes_trigger`. Their
+  // boundaries also let the later L0->Lbase compaction be split into
+  // subcompactions.
+  //
+  // Default: 0 (the output of an L0->L0 compaction is a single file)
+  //
+  // Dynamically changeable through SetOptions() API
+  uint64_t intra_l0_compaction_output_file_size = 0;
+
+  // EXPERIMENTAL
+  // Only used with `compaction_style = kCompactionStyleLevel`. If positive, a
+  // file whose range tombstones cover data in lower levels of more than this
+  // multiple of its own size (e.g. after a large `DeleteRange()`) is marked
+  // for compaction, so that the tombstones are compacted down with the data
+  // they cover instead of being consulted by reads until size-based
+  // compactions get to them. The covered size is the estimate that is also
+  // added to the compensated file size, and the files written by such a
+  // compaction are marked again as long as their tombstones still cover
+  // enough data below them.
+  //
+  // Default: 0 (disabled)
+  //
+  // Dynamically changeable through SetOptions() API
+  double range_deletion_compaction_trigger_ratio = 0;
+
   // The options needed to support Universal Style compactions
   //
   // Dynamically changeable through SetOptions() API
@@ -1186,6 +1186,12 @@ class DB {
     //      stale values more frequently to reduce overhead and latency.
     static const std::string kFastBlockCacheEntryStats;
 
+    //  "rocksdb.block-cache-simulation" - returns a multi-line string with
+    //      the number of sampled accesses and the miss ratios (in percent)
+    //      observed so far by each simulated block cache capacity. See
+    //      `DBOptions::block_cache_simulation_capacities`.
+    static const std::string kBlockCacheSimulation;
+
     //  "rocksdb.num-immutable-mem-table" - returns number of immutable
     //      memtables that have not yet been flushed.
     static const std::string kNumImmutableMemTable;
@@ -1287,6 +1287,36 @@ struct DBOptions {
   // Default: nullptr (disabled)
   std::shared_ptr<RowCache> row_cache = nullptr;
 
+  // EXPERIMENTAL
+  //
+  // A cache for the results of point lookups (Get, GetEntity, MultiGet, and
+  // MultiGetEntity), keyed by column family and user key. Unlike `row_cache`,
+  // which caches per-file lookup results, a hit here skips memtable, filter,
+  // and index lookups altogether, which makes it suited to skewed workloads
+  // with a small set of very hot keys. Lookups that did not find the key are
+  // cached as well.
+  //
+  // Cached results are kept consistent with writes, range deletions, file
+  // ingestion, DeleteFilesInRanges(), and files dropped by FIFO compaction,
+  // and are only served to reads (including snapshot reads) whose
+  // sequence number is at least that of the read that populated the entry.
+  // Only results read with `ReadOptions::fill_cache == true` are cached.
+  //
+  // The cache is bypassed for reads with user-defined timestamps, in
+  // transactions, with `read_tier != kReadAllTier`, with
+  // `merge_operand_count_threshold`, or with `ignore_range_deletions`, and for
+  // column families with a compaction filter (which can change results
+  // without a write). With FIFO compaction, dropping files invalidates all
+  // cached results. It is not
+  // used with `unordered_write`, WritePrepared/WriteUnprepared transactions,
+  // or secondary and follower instances.
+  //
+  // The cache can be shared with other DBs, but should not be shared with
+  // block caches.
+  //
+  // Default: nullptr (disabled)
+  std::shared_ptr<RowCache> hot_row_cache = nullptr;
+
   // A filter object supplied to be invoked while processing write-ahead-logs
   // (WALs) during recovery. The filter provides a way to inspect log
   // records, ignoring a particular record or skipping replay.
@@ -1619,6 +1649,27 @@ struct DBOptions {
   // `kUnknown`, this overrides any temperature set by OptimizeForLogWrite
   // functions.
   Temperature wal_write_temperature = Temperature::kUnknown;
+
+  // If non-empty, RocksDB continuously simulates LRU block caches of these
+  // capacities (in bytes) against a sample of the DB's live block cache
+  // accesses, and reports the observed miss ratios through the
+  // "rocksdb.block-cache-simulation" DB property. This allows sizing the block
+  // cache from production traffic without taking and analyzing a block cache
+  // trace (see also tools/block_cache_analyzer). Simulation works alongside
+  // block cache tracing and does not require it.
+  //
+  // Default: empty (disabled)
+  std::vector<uint64_t> block_cache_simulation_capacities;
+
+  // The sampling rate of block cache simulation: one in this many blocks
+  // (selected by block cache key, so each sampled block has its full access
+  // history) is simulated, in caches scaled down by the same factor. An
+  // access to a block that is not sampled only costs hashing its cache key.
+  // Higher values reduce the CPU and memory overhead of simulation at the cost
+  // of accuracy.
+  //
+  // Default: 100 (1% of blocks)
+  uint64_t block_cache_simulation_sampling_frequency = 100;
   // End EXPERIMENTAL
 };
 
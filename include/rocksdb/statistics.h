@@ -534,6 +534,11 @@ enum Tickers : uint32_t {
   FILE_READ_CORRUPTION_RETRY_COUNT,
   FILE_READ_CORRUPTION_RETRY_SUCCESS_COUNT,
 
+  // Number of point lookups served from / not found in
+  // DBOptions::hot_row_cache
+  HOT_ROW_CACHE_HIT,
+  HOT_ROW_CACHE_MISS,
+
   TICKER_ENUM_MAX
 };
 
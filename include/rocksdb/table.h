@@ -685,6 +685,30 @@ struct BlockBasedTableOptions {
   //
   // Default: 2
   uint64_t num_file_reads_for_auto_readahead = 2;
+
+  // If true, data blocks read into the block cache by an iterator that has
+  // been detected as doing a sequential scan (i.e. after reading more than
+  // `num_file_reads_for_auto_readahead`, and at least one, consecutive data
+  // blocks of the table file) are inserted with Cache::Priority::BOTTOM
+  // instead of the usual priority. The detection does not depend on whether
+  // readahead is used, e.g. with ReadOptions::async_io or readahead_size.
+  // Such blocks are then the first to be evicted unless they are hit again
+  // (shortest initial clock countdown with HyperClockCache; bottom pool with
+  // LRUCache, which requires LRUCacheOptions::low_pri_pool_ratio > 0 to make a
+  // difference), so large scans do not flush the working set of point lookups
+  // out of the cache.
+  // Blocks read by point lookups and by the first few block reads after each
+  // seek of an iterator are not affected.
+  //
+  // This parameter can be changed dynamically by
+  // DB::SetOptions({{"block_based_table_factory",
+  //                  "{bottom_priority_for_scan_blocks=true;}"}}));
+  //
+  // Changing the value dynamically will only affect files opened after the
+  // change.
+  //
+  // Default: false
+  bool bottom_priority_for_scan_blocks = false;
 };
 
 // Table Properties that are specific to block-based table properties.
@@ -0,0 +1,70 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rocksdb/options.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// EXPERIMENTAL
+// A CompactionService (see `DBOptions::compaction_service`) that runs each
+// compaction in a separate worker process on the local host, for example so
+// that compaction CPU usage can be isolated from the serving process (e.g. in
+// a separate cgroup).
+//
+// The service and the workers exchange data through a work directory, in
+// which each job has its own subdirectory holding the compaction input, the
+// output files, and the result. A job is run by executing
+//
+//   <worker_path> <worker_args>... --db=<db name> --job_dir=<job directory>
+//
+// tools/compaction_worker is a ready-made worker. Custom workers (e.g. ones
+// that need custom comparators or merge operators) can be built around
+// RunLocalCompactionServiceJob().
+struct LocalCompactionServiceOptions {
+  // Path of the worker executable. Required.
+  std::string worker_path;
+
+  // Additional arguments passed to the worker before the job arguments.
+  std::vector<std::string> worker_args;
+
+  // Directory holding the job subdirectories. Must be on the same file system
+  // as the DB, because output files are renamed into the DB when the result
+  // of a job is installed. Required.
+  std::string work_dir;
+
+  // Maximum number of worker processes running at the same time. Jobs beyond
+  // this limit wait until a worker finishes.
+  int max_workers = 1;
+};
+
+// Returns a new CompactionService running compactions in worker processes.
+// `CancelAwaitingJobs()` fails the jobs waiting for a worker and terminates
+// the running workers. Not supported on Windows, where all compactions run
+// in the DB process.
+std::shared_ptr<CompactionService> NewLocalCompactionService(
+    const LocalCompactionServiceOptions& options);
+
+// Worker side: runs the compaction job in `job_dir` for the DB `db_name` and
+// stores the result in `job_dir` for the service to pick up. If
+// `override_options` is null, the objects passed to DB::OpenAndCompact()
+// (comparator, table factory, etc.) are created from the DB's OPTIONS file,
+// which works for built-in objects and those registered with the
+// ObjectRegistry. Otherwise `override_options` is used as is.
+Status RunLocalCompactionServiceJob(
+    const std::string& db_name, const std::string& job_dir,
+    const CompactionServiceOptionsOverride* override_options = nullptr);
+
+// Worker side: parses the command line described above and runs the job.
+// Returns the exit code for the worker process.
+int RunLocalCompactionServiceWorker(int argc, char** argv);
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -41,7 +41,14 @@ public enum CompactionPriority {
    * level. The file picking process will cycle through all the files in a
    * round-robin manner.
    */
-  RoundRobin((byte)0x4);
+  RoundRobin((byte)0x4),
+
+  /**
+   * EXPERIMENTAL. First compact files with the highest estimated benefit
+   * (data moved down, reads and space saved) per byte written by the
+   * compaction.
+   */
+  MaxBenefitPerCost((byte)0x5);
 
 
   private final byte value;
@@ -882,6 +882,10 @@ public enum TickerType {
 
     FILE_READ_CORRUPTION_RETRY_SUCCESS_COUNT((byte) -0x57),
 
+    HOT_ROW_CACHE_HIT((byte) -0x58),
+
+    HOT_ROW_CACHE_MISS((byte) -0x59),
+
     TICKER_ENUM_MAX((byte) -0x54);
 
     private final byte value;
@@ -17,6 +17,7 @@
 
 #include "port/port.h"
 #include "util/cast_util.h"
+#include "util/math.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -39,16 +40,26 @@ HistogramBucketMapper::HistogramBucketMapper() {
   }
   maxBucketValue_ = bucketValues_.back();
   minBucketValue_ = bucketValues_.front();
+  assert(bucketValues_.size() <= std::numeric_limits<uint8_t>::max());
+  for (size_t k = 0; k < firstIndexForLog2_.size(); ++k) {
+    firstIndexForLog2_[k] = static_cast<uint8_t>(
+        std::lower_bound(bucketValues_.begin(), bucketValues_.end(),
+                         uint64_t{1} << k) -
+        bucketValues_.begin());
+  }
 }
 
 size_t HistogramBucketMapper::IndexForValue(const uint64_t value) const {
-  auto beg = bucketValues_.begin();
-  auto end = bucketValues_.end();
   if (value >= maxBucketValue_) {
-    return end - beg - 1;  // bucketValues_.size() - 1
-  } else {
-    return std::lower_bound(beg, end, value) - beg;
+    return bucketValues_.size() - 1;
+  }
+  // Bucket limits grow by ~1.5x, so only a couple of buckets can share the
+  // same floor(log2()) and the linear scan below is short.
+  size_t index = value == 0 ? 0 : firstIndexForLog2_[FloorLog2(value)];
+  while (bucketValues_[index] < value) {
+    ++index;
   }
+  return index;
 }
 
 namespace {
@@ -8,6 +8,7 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 
 #pragma once
+#include <array>
 #include <cassert>
 #include <map>
 #include <mutex>
@@ -41,6 +42,11 @@ class HistogramBucketMapper {
   std::vector<uint64_t> bucketValues_;
   uint64_t maxBucketValue_;
   uint64_t minBucketValue_;
+  // For each k, the index of the first bucket whose limit is >= 2^k. Lets
+  // IndexForValue() start its search next to the result instead of doing a
+  // binary search over all buckets, as it is on the hot path of every
+  // histogram update.
+  std::array<uint8_t, 64> firstIndexForLog2_;
 };
 
 struct HistogramStat {
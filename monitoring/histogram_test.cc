@@ -108,6 +108,37 @@ TEST_F(HistogramTest, BoundaryValue) {
   ASSERT_LE(fabs(histogram.Percentile(50.0) - 0.5), kIota);
 }
 
+TEST_F(HistogramTest, BucketMapperIndexForValue) {
+  auto expected_index = [&](uint64_t value) {
+    size_t index = 0;
+    while (index + 1 < bucketMapper.BucketCount() &&
+           bucketMapper.BucketLimit(index) < value) {
+      ++index;
+    }
+    return index;
+  };
+  std::vector<uint64_t> values{0, std::numeric_limits<uint64_t>::max()};
+  for (size_t b = 0; b < bucketMapper.BucketCount(); ++b) {
+    const uint64_t limit = bucketMapper.BucketLimit(b);
+    values.push_back(limit - 1);
+    values.push_back(limit);
+    values.push_back(limit + 1);
+  }
+  for (int k = 0; k < 64; ++k) {
+    const uint64_t pow2 = uint64_t{1} << k;
+    values.push_back(pow2 - 1);
+    values.push_back(pow2);
+    values.push_back(pow2 + 1);
+  }
+  Random64 rnd(301);
+  for (int i = 0; i < 10000; ++i) {
+    values.push_back(rnd.Next() >> rnd.Uniform(64));
+  }
+  for (uint64_t value : values) {
+    ASSERT_EQ(bucketMapper.IndexForValue(value), expected_index(value)) << value;
+  }
+}
+
 TEST_F(HistogramTest, MergeHistogram) {
   HistogramImpl histogram;
   HistogramImpl other;
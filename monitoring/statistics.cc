@@ -270,6 +270,8 @@ const std::vector<std::pair<Tickers, std::string>> TickersNameMap = {
      "rocksdb.file.read.corruption.retry.count"},
     {FILE_READ_CORRUPTION_RETRY_SUCCESS_COUNT,
      "rocksdb.file.read.corruption.retry.success.count"},
+    {HOT_ROW_CACHE_HIT, "rocksdb.hot.row.cache.hit"},
+    {HOT_ROW_CACHE_MISS, "rocksdb.hot.row.cache.miss"},
 };
 
 const std::vector<std::pair<Histograms, std::string>> HistogramsNameMap = {
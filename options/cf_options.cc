@@ -471,6 +471,21 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct MutableCFOptions, memtable_prefix_bloom_size_ratio),
           OptionType::kDouble, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"compaction_pri_read_half_life_seconds",
+         {offsetof(struct MutableCFOptions,
+                   compaction_pri_read_half_life_seconds),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
+        {"intra_l0_compaction_output_file_size",
+         {offsetof(struct MutableCFOptions,
+                   intra_l0_compaction_output_file_size),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
+        {"range_deletion_compaction_trigger_ratio",
+         {offsetof(struct MutableCFOptions,
+                   range_deletion_compaction_trigger_ratio),
+          OptionType::kDouble, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"memtable_prefix_bloom_probes",
          {0, OptionType::kUInt32T, OptionVerificationType::kDeprecated,
           OptionTypeFlags::kMutable}},
@@ -552,6 +567,14 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct MutableCFOptions, periodic_compaction_seconds),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"compaction_pri_bytes_per_read",
+         {offsetof(struct MutableCFOptions, compaction_pri_bytes_per_read),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
+        {"compaction_pri_space_weight",
+         {offsetof(struct MutableCFOptions, compaction_pri_space_weight),
+          OptionType::kDouble, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"preclude_last_level_data_seconds",
          {offsetof(struct MutableCFOptions, preclude_last_level_data_seconds),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
@@ -1140,6 +1163,18 @@ void MutableCFOptions::Dump(Logger* log) const {
                  ttl);
   ROCKS_LOG_INFO(log, "              periodic_compaction_seconds: %" PRIu64,
                  periodic_compaction_seconds);
+  ROCKS_LOG_INFO(log, "            compaction_pri_bytes_per_read: %" PRIu64,
+                 compaction_pri_bytes_per_read);
+  ROCKS_LOG_INFO(log, "              compaction_pri_space_weight: %f",
+                 compaction_pri_space_weight);
+  ROCKS_LOG_INFO(log,
+                 "    compaction_pri_read_half_life_seconds: %" PRIu64,
+                 compaction_pri_read_half_life_seconds);
+  ROCKS_LOG_INFO(log,
+                 "     intra_l0_compaction_output_file_size: %" PRIu64,
+                 intra_l0_compaction_output_file_size);
+  ROCKS_LOG_INFO(log, "  range_deletion_compaction_trigger_ratio: %f",
+                 range_deletion_compaction_trigger_ratio);
   ROCKS_LOG_INFO(log,
                  "              preclude_last_level_data_seconds: %" PRIu64,
                  preclude_last_level_data_seconds);
@@ -134,6 +134,14 @@ struct MutableCFOptions {
         max_bytes_for_level_multiplier(options.max_bytes_for_level_multiplier),
         ttl(options.ttl),
         periodic_compaction_seconds(options.periodic_compaction_seconds),
+        compaction_pri_bytes_per_read(options.compaction_pri_bytes_per_read),
+        compaction_pri_space_weight(options.compaction_pri_space_weight),
+        compaction_pri_read_half_life_seconds(
+            options.compaction_pri_read_half_life_seconds),
+        intra_l0_compaction_output_file_size(
+            options.intra_l0_compaction_output_file_size),
+        range_deletion_compaction_trigger_ratio(
+            options.range_deletion_compaction_trigger_ratio),
         max_bytes_for_level_multiplier_additional(
             options.max_bytes_for_level_multiplier_additional),
         compaction_options_fifo(options.compaction_options_fifo),
@@ -202,6 +210,11 @@ struct MutableCFOptions {
         max_bytes_for_level_multiplier(0),
         ttl(0),
         periodic_compaction_seconds(0),
+        compaction_pri_bytes_per_read(0),
+        compaction_pri_space_weight(0.0),
+        compaction_pri_read_half_life_seconds(0),
+        intra_l0_compaction_output_file_size(0),
+        range_deletion_compaction_trigger_ratio(0.0),
         compaction_options_fifo(),
         preclude_last_level_data_seconds(0),
         preserve_internal_time_seconds(0),
@@ -295,6 +308,11 @@ struct MutableCFOptions {
   double max_bytes_for_level_multiplier;
   uint64_t ttl;
   uint64_t periodic_compaction_seconds;
+  uint64_t compaction_pri_bytes_per_read;
+  double compaction_pri_space_weight;
+  uint64_t compaction_pri_read_half_life_seconds;
+  uint64_t intra_l0_compaction_output_file_size;
+  double range_deletion_compaction_trigger_ratio;
   std::vector<int> max_bytes_for_level_multiplier_additional;
   CompactionOptionsFIFO compaction_options_fifo;
   CompactionOptionsUniversal compaction_options_universal;
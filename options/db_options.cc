@@ -135,6 +135,7 @@ static std::unordered_map<std::string, OptionTypeInfo>
         /*
          // not yet supported
           std::shared_ptr<Cache> row_cache;
+          std::shared_ptr<Cache> hot_row_cache;
           std::shared_ptr<DeleteScheduler> delete_scheduler;
           std::shared_ptr<Logger> info_log;
           std::shared_ptr<RateLimiter> rate_limiter;
@@ -595,6 +596,17 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct ImmutableDBOptions, wal_write_temperature),
           OptionType::kTemperature, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"block_cache_simulation_capacities",
+         OptionTypeInfo::Vector<uint64_t>(
+             offsetof(struct ImmutableDBOptions,
+                      block_cache_simulation_capacities),
+             OptionVerificationType::kNormal, OptionTypeFlags::kNone,
+             {0, OptionType::kUInt64T})},
+        {"block_cache_simulation_sampling_frequency",
+         {offsetof(struct ImmutableDBOptions,
+                   block_cache_simulation_sampling_frequency),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
 };
 
 const std::string OptionsHelper::kDBOptionsName = "DBOptions";
@@ -770,6 +782,7 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       wal_recovery_mode(options.wal_recovery_mode),
       allow_2pc(options.allow_2pc),
       row_cache(options.row_cache),
+      hot_row_cache(options.hot_row_cache),
       wal_filter(options.wal_filter),
       fail_if_options_file_error(options.fail_if_options_file_error),
       dump_malloc_stats(options.dump_malloc_stats),
@@ -801,7 +814,11 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       follower_catchup_retry_count(options.follower_catchup_retry_count),
       follower_catchup_retry_wait_ms(options.follower_catchup_retry_wait_ms),
       metadata_write_temperature(options.metadata_write_temperature),
-      wal_write_temperature(options.wal_write_temperature) {
+      wal_write_temperature(options.wal_write_temperature),
+      block_cache_simulation_capacities(
+          options.block_cache_simulation_capacities),
+      block_cache_simulation_sampling_frequency(
+          options.block_cache_simulation_sampling_frequency) {
   fs = env->GetFileSystem();
   clock = env->GetSystemClock().get();
   logger = info_log.get();
@@ -937,6 +954,15 @@ void ImmutableDBOptions::Dump(Logger* log) const {
     ROCKS_LOG_HEADER(log,
                      "                              Options.row_cache: None");
   }
+  if (hot_row_cache) {
+    ROCKS_LOG_HEADER(
+        log,
+        "                          Options.hot_row_cache: %" ROCKSDB_PRIszt,
+        hot_row_cache->GetCapacity());
+  } else {
+    ROCKS_LOG_HEADER(log,
+                     "                          Options.hot_row_cache: None");
+  }
   ROCKS_LOG_HEADER(log, "                             Options.wal_filter: %s",
                    wal_filter ? wal_filter->Name() : "None");
 
@@ -987,6 +1013,18 @@ void ImmutableDBOptions::Dump(Logger* log) const {
                    temperature_to_string[metadata_write_temperature].c_str());
   ROCKS_LOG_HEADER(log, "            Options.wal_write_temperature: %s",
                    temperature_to_string[wal_write_temperature].c_str());
+  std::string simulation_capacities;
+  for (uint64_t capacity : block_cache_simulation_capacities) {
+    if (!simulation_capacities.empty()) {
+      simulation_capacities.append(":");
+    }
+    simulation_capacities.append(std::to_string(capacity));
+  }
+  ROCKS_LOG_HEADER(log, "Options.block_cache_simulation_capacities: %s",
+                   simulation_capacities.c_str());
+  ROCKS_LOG_HEADER(
+      log, "Options.block_cache_simulation_sampling_frequency: %" PRIu64,
+      block_cache_simulation_sampling_frequency);
 }
 
 bool ImmutableDBOptions::IsWalDirSameAsDBPath() const {
@@ -76,6 +76,7 @@ struct ImmutableDBOptions {
   WALRecoveryMode wal_recovery_mode;
   bool allow_2pc;
   std::shared_ptr<Cache> row_cache;
+  std::shared_ptr<Cache> hot_row_cache;
   WalFilter* wal_filter;
   bool fail_if_options_file_error;
   bool dump_malloc_stats;
@@ -107,6 +108,8 @@ struct ImmutableDBOptions {
   uint64_t follower_catchup_retry_wait_ms;
   Temperature metadata_write_temperature;
   Temperature wal_write_temperature;
+  std::vector<uint64_t> block_cache_simulation_capacities;
+  uint64_t block_cache_simulation_sampling_frequency;
 
   // Beginning convenience/helper objects that are not part of the base
   // DBOptions
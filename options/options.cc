@@ -77,6 +77,14 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
           options.hard_pending_compaction_bytes_limit),
       compaction_style(options.compaction_style),
       compaction_pri(options.compaction_pri),
+      compaction_pri_bytes_per_read(options.compaction_pri_bytes_per_read),
+      compaction_pri_space_weight(options.compaction_pri_space_weight),
+      compaction_pri_read_half_life_seconds(
+          options.compaction_pri_read_half_life_seconds),
+      intra_l0_compaction_output_file_size(
+          options.intra_l0_compaction_output_file_size),
+      range_deletion_compaction_trigger_ratio(
+          options.range_deletion_compaction_trigger_ratio),
       compaction_options_universal(options.compaction_options_universal),
       compaction_options_fifo(options.compaction_options_fifo),
       max_sequential_skip_in_iterations(
@@ -323,6 +331,19 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
   }
   ROCKS_LOG_HEADER(log, "                         Options.compaction_pri: %s",
                    str_compaction_pri.c_str());
+  ROCKS_LOG_HEADER(log,
+                   "          Options.compaction_pri_bytes_per_read: %" PRIu64,
+                   compaction_pri_bytes_per_read);
+  ROCKS_LOG_HEADER(log, "            Options.compaction_pri_space_weight: %f",
+                   compaction_pri_space_weight);
+  ROCKS_LOG_HEADER(
+      log, "  Options.compaction_pri_read_half_life_seconds: %" PRIu64,
+      compaction_pri_read_half_life_seconds);
+  ROCKS_LOG_HEADER(
+      log, "   Options.intra_l0_compaction_output_file_size: %" PRIu64,
+      intra_l0_compaction_output_file_size);
+  ROCKS_LOG_HEADER(log, "Options.range_deletion_compaction_trigger_ratio: %f",
+                   range_deletion_compaction_trigger_ratio);
   ROCKS_LOG_HEADER(log, "Options.compaction_options_universal.size_ratio: %u",
                    compaction_options_universal.size_ratio);
   ROCKS_LOG_HEADER(log,
@@ -152,6 +152,7 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.wal_recovery_mode = immutable_db_options.wal_recovery_mode;
   options.allow_2pc = immutable_db_options.allow_2pc;
   options.row_cache = immutable_db_options.row_cache;
+  options.hot_row_cache = immutable_db_options.hot_row_cache;
   options.wal_filter = immutable_db_options.wal_filter;
   options.fail_if_options_file_error =
       immutable_db_options.fail_if_options_file_error;
@@ -198,6 +199,10 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.metadata_write_temperature =
       immutable_db_options.metadata_write_temperature;
   options.wal_write_temperature = immutable_db_options.wal_write_temperature;
+  options.block_cache_simulation_capacities =
+      immutable_db_options.block_cache_simulation_capacities;
+  options.block_cache_simulation_sampling_frequency =
+      immutable_db_options.block_cache_simulation_sampling_frequency;
   options.compaction_service = immutable_db_options.compaction_service;
 }
 
@@ -255,6 +260,15 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
       moptions.max_bytes_for_level_multiplier;
   cf_opts->ttl = moptions.ttl;
   cf_opts->periodic_compaction_seconds = moptions.periodic_compaction_seconds;
+  cf_opts->compaction_pri_bytes_per_read =
+      moptions.compaction_pri_bytes_per_read;
+  cf_opts->compaction_pri_space_weight = moptions.compaction_pri_space_weight;
+  cf_opts->compaction_pri_read_half_life_seconds =
+      moptions.compaction_pri_read_half_life_seconds;
+  cf_opts->intra_l0_compaction_output_file_size =
+      moptions.intra_l0_compaction_output_file_size;
+  cf_opts->range_deletion_compaction_trigger_ratio =
+      moptions.range_deletion_compaction_trigger_ratio;
   cf_opts->preclude_last_level_data_seconds =
       moptions.preclude_last_level_data_seconds;
   cf_opts->preserve_internal_time_seconds =
@@ -352,7 +366,8 @@ std::map<CompactionPri, std::string> OptionsHelper::compaction_pri_to_string = {
     {kOldestLargestSeqFirst, "kOldestLargestSeqFirst"},
     {kOldestSmallestSeqFirst, "kOldestSmallestSeqFirst"},
     {kMinOverlappingRatio, "kMinOverlappingRatio"},
-    {kRoundRobin, "kRoundRobin"}};
+    {kRoundRobin, "kRoundRobin"},
+    {kMaxBenefitPerCost, "kMaxBenefitPerCost"}};
 
 std::map<CompactionStopStyle, std::string>
     OptionsHelper::compaction_stop_style_to_string = {
@@ -814,7 +829,8 @@ std::unordered_map<std::string, CompactionPri>
         {"kOldestLargestSeqFirst", kOldestLargestSeqFirst},
         {"kOldestSmallestSeqFirst", kOldestSmallestSeqFirst},
         {"kMinOverlappingRatio", kMinOverlappingRatio},
-        {"kRoundRobin", kRoundRobin}};
+        {"kRoundRobin", kRoundRobin},
+        {"kMaxBenefitPerCost", kMaxBenefitPerCost}};
 
 std::unordered_map<std::string, CompactionStopStyle>
     OptionsHelper::compaction_stop_style_string_map = {
@@ -201,7 +201,8 @@ TEST_F(OptionsSettableTest, BlockBasedTableOptionsAllFieldsSettable) {
       "max_auto_readahead_size=0;"
       "prepopulate_block_cache=kDisable;"
       "initial_auto_readahead_size=0;"
-      "num_file_reads_for_auto_readahead=0",
+      "num_file_reads_for_auto_readahead=0;"
+      "bottom_priority_for_scan_blocks=false",
       new_bbto));
 
   ASSERT_EQ(unset_bytes_base,
@@ -333,6 +334,8 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
       {offsetof(struct DBOptions, listeners),
        sizeof(std::vector<std::shared_ptr<EventListener>>)},
       {offsetof(struct DBOptions, row_cache), sizeof(std::shared_ptr<Cache>)},
+      {offsetof(struct DBOptions, hot_row_cache),
+       sizeof(std::shared_ptr<Cache>)},
       {offsetof(struct DBOptions, wal_filter), sizeof(const WalFilter*)},
       {offsetof(struct DBOptions, file_checksum_gen_factory),
        sizeof(std::shared_ptr<FileChecksumGenFactory>)},
@@ -342,6 +345,8 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
       {offsetof(struct DBOptions, compaction_service),
        sizeof(std::shared_ptr<CompactionService>)},
       {offsetof(struct DBOptions, daily_offpeak_time_utc), sizeof(std::string)},
+      {offsetof(struct DBOptions, block_cache_simulation_capacities),
+       sizeof(std::vector<uint64_t>)},
   };
 
   char* options_ptr = new char[sizeof(DBOptions)];
@@ -468,6 +473,8 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
                              "follower_catchup_retry_wait_ms=789;"
                              "metadata_write_temperature=kCold;"
                              "wal_write_temperature=kHot;"
+                             "block_cache_simulation_capacities=1024:2048;"
+                             "block_cache_simulation_sampling_frequency=10;"
                              "background_close_inactive_wals=true;"
                              "write_dbid_to_manifest=true;"
                              "write_identity_file=true;"
@@ -646,6 +653,11 @@ TEST_F(OptionsSettableTest, ColumnFamilyOptionsAllFieldsSettable) {
       "report_bg_io_stats=true;"
       "ttl=60;"
       "periodic_compaction_seconds=3600;"
+      "compaction_pri_bytes_per_read=8192;"
+      "compaction_pri_space_weight=0.5;"
+      "compaction_pri_read_half_life_seconds=600;"
+      "intra_l0_compaction_output_file_size=33554432;"
+      "range_deletion_compaction_trigger_ratio=2.0;"
       "sample_for_compression=0;"
       "enable_blob_files=true;"
       "min_blob_size=256;"
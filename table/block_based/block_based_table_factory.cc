@@ -392,6 +392,10 @@ static struct BlockBasedTableTypeInfo {
          {offsetof(struct BlockBasedTableOptions,
                    num_file_reads_for_auto_readahead),
           OptionType::kUInt64T, OptionVerificationType::kNormal}},
+        {"bottom_priority_for_scan_blocks",
+         {offsetof(struct BlockBasedTableOptions,
+                   bottom_priority_for_scan_blocks),
+          OptionType::kBoolean, OptionVerificationType::kNormal}},
     };
   }
 } block_based_table_type_info;
@@ -839,6 +843,9 @@ std::string BlockBasedTableFactory::GetPrintableOptions() const {
            "  num_file_reads_for_auto_readahead: %" PRIu64 "\n",
            table_options_.num_file_reads_for_auto_readahead);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  bottom_priority_for_scan_blocks: %d\n",
+           table_options_.bottom_priority_for_scan_blocks);
+  ret.append(buffer);
   return ret;
 }
 
@@ -397,6 +397,7 @@ void BlockBasedTableIterator::InitDataBlock() {
           is_for_compaction,
           /*no_sequential_checking=*/false, read_options_, readaheadsize_cb,
           read_options_.async_io);
+      lookup_context_.in_sequential_scan = block_prefetcher_.InSequentialScan();
 
       Status s;
       table_->NewDataBlockIterator<DataBlockIter>(
@@ -457,6 +458,7 @@ void BlockBasedTableIterator::AsyncInitDataBlock(bool is_first_pass) {
           rep, data_block_handle, read_options_.readahead_size,
           is_for_compaction, /*no_sequential_checking=*/read_options_.async_io,
           read_options_, readaheadsize_cb, read_options_.async_io);
+      lookup_context_.in_sequential_scan = block_prefetcher_.InSequentialScan();
 
       Status s;
       table_->NewDataBlockIterator<DataBlockIter>(
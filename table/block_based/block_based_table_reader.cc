@@ -104,7 +104,12 @@ CacheAllocationPtr CopyBufferToHeap(MemoryAllocator* allocator, Slice& buf) {
       bool use_block_cache_for_lookup) const;                                  \
   template Status BlockBasedTable::LookupAndPinBlocksInCache<T>(               \
       const ReadOptions& ro, const BlockHandle& handle,                        \
-      CachableEntry<T>* out_parsed_block) const;
+      CachableEntry<T>* out_parsed_block) const;                               \
+  template void BlockBasedTable::LookupBlocksInCacheBatched<T>(                \
+      const ReadOptions& ro, const BlockHandle* handles, size_t count,         \
+      const UncompressionDict& uncompression_dict, GetContext* get_context,    \
+      BlockCacheLookupContext* lookup_context,                                 \
+      CachableEntry<T>* out_parsed_blocks) const;
 
 INSTANTIATE_BLOCKLIKE_TEMPLATES(ParsedFullFilterBlock);
 INSTANTIATE_BLOCKLIKE_TEMPLATES(UncompressionDict);
@@ -1338,6 +1343,20 @@ Cache::Priority BlockBasedTable::GetCachePriority() const {
   }
 }
 
+template <typename TBlocklike>
+Cache::Priority BlockBasedTable::GetCacheInsertPriority(
+    const BlockCacheLookupContext* lookup_context) const {
+  if constexpr (TBlocklike::kBlockType == BlockType::kData) {
+    // Keep blocks of a sequential scan from displacing the working set unless
+    // they are hit again.
+    if (rep_->table_options.bottom_priority_for_scan_blocks &&
+        lookup_context != nullptr && lookup_context->in_sequential_scan) {
+      return Cache::Priority::BOTTOM;
+    }
+  }
+  return GetCachePriority<TBlocklike>();
+}
+
 template <typename TBlocklike>
 WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::GetDataBlockFromCache(
     const Slice& cache_key, BlockCacheInterface<TBlocklike> block_cache,
@@ -1387,7 +1406,8 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::PutDataBlockToCache(
     BlockContents&& uncompressed_block_contents,
     BlockContents&& compressed_block_contents, CompressionType block_comp_type,
     const UncompressionDict& uncompression_dict,
-    MemoryAllocator* memory_allocator, GetContext* get_context) const {
+    MemoryAllocator* memory_allocator, GetContext* get_context,
+    Cache::Priority priority) const {
   const ImmutableOptions& ioptions = rep_->ioptions;
   const uint32_t format_version = rep_->table_options.format_version;
   assert(out_parsed_block);
@@ -1419,7 +1439,7 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::PutDataBlockToCache(
     size_t charge = block_holder->ApproximateMemoryUsage();
     BlockCacheTypedHandle<TBlocklike>* cache_handle = nullptr;
     s = block_cache.InsertFull(cache_key, block_holder.get(), charge,
-                               &cache_handle, GetCachePriority<TBlocklike>(),
+                               &cache_handle, priority,
                                rep_->ioptions.lowest_used_cache_tier,
                                compressed_block_contents.data, block_comp_type);
 
@@ -1699,7 +1719,8 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
           s = PutDataBlockToCache(
               key, block_cache, out_parsed_block, std::move(uncomp_contents),
               std::move(comp_contents), contents_comp_type, uncompression_dict,
-              GetMemoryAllocator(rep_->table_options), get_context);
+              GetMemoryAllocator(rep_->table_options), get_context,
+              GetCacheInsertPriority<TBlocklike>(lookup_context));
         }
       } else {
         contents_comp_type = GetBlockCompressionType(*contents);
@@ -1715,15 +1736,16 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
           s = PutDataBlockToCache(
               key, block_cache, out_parsed_block, std::move(uncomp_contents),
               std::move(comp_contents), contents_comp_type, uncompression_dict,
-              GetMemoryAllocator(rep_->table_options), get_context);
+              GetMemoryAllocator(rep_->table_options), get_context,
+              GetCacheInsertPriority<TBlocklike>(lookup_context));
         }
       }
     }
   }
 
   // TODO: optimize so that lookup_context != nullptr implies the others
-  if (block_cache_tracer_ && block_cache_tracer_->is_tracing_enabled() &&
-      lookup_context) {
+  if (block_cache_tracer_ && lookup_context &&
+      block_cache_tracer_->ShouldRecordBlockAccess(key)) {
     SaveLookupContextOrTraceRecord(
         key, is_cache_hit, ro, out_parsed_block->GetValue(), lookup_context);
   }
@@ -1732,6 +1754,59 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
   return s;
 }
 
+template <typename TBlocklike>
+WithBlocklikeCheck<void, TBlocklike>
+BlockBasedTable::LookupBlocksInCacheBatched(
+    const ReadOptions& ro, const BlockHandle* handles, size_t count,
+    const UncompressionDict& uncompression_dict, GetContext* get_context,
+    BlockCacheLookupContext* lookup_context,
+    CachableEntry<TBlocklike>* out_parsed_blocks) const {
+  using BCI = BlockCacheInterface<TBlocklike>;
+  BCI block_cache{rep_->table_options.block_cache.get()};
+  assert(block_cache);
+
+  BlockCreateContext create_ctx = rep_->create_context;
+  create_ctx.dict = &uncompression_dict;
+
+  std::vector<CacheKey> cache_keys(count);
+  std::vector<typename BCI::TypedAsyncLookupHandle> async_handles(count);
+  for (size_t i = 0; i < count; ++i) {
+    assert(out_parsed_blocks[i].IsEmpty());
+    cache_keys[i] = GetCacheKey(rep_->base_cache_key, handles[i]);
+    auto& async_handle = async_handles[i];
+    async_handle.key = cache_keys[i].AsSlice();
+    // NB: StartAsyncLookupFull populates async_handle.helper
+    async_handle.create_context = &create_ctx;
+    async_handle.priority = GetCachePriority<TBlocklike>();
+    async_handle.stats = rep_->ioptions.statistics.get();
+    block_cache.StartAsyncLookupFull(async_handle,
+                                     rep_->ioptions.lowest_used_cache_tier);
+  }
+  block_cache.get()->WaitAll(async_handles.data(), count);
+
+  const bool tracing = block_cache_tracer_ && lookup_context;
+  for (size_t i = 0; i < count; ++i) {
+    typename BCI::TypedHandle* h = async_handles[i].Result();
+    if (h == nullptr) {
+      // The caller reads the block without another lookup, which records the
+      // trace of the miss.
+      UpdateCacheMissMetrics(TBlocklike::kBlockType, get_context);
+      continue;
+    }
+    out_parsed_blocks[i].SetCachedValue(block_cache.Value(h), block_cache.get(),
+                                        h);
+    UpdateCacheHitMetrics(TBlocklike::kBlockType, get_context,
+                          block_cache.get()->GetUsage(h));
+    if (tracing &&
+        block_cache_tracer_->ShouldRecordBlockAccess(async_handles[i].key)) {
+      SaveLookupContextOrTraceRecord(async_handles[i].key,
+                                     /* is_cache_hit */ true, ro,
+                                     out_parsed_blocks[i].GetValue(),
+                                     lookup_context);
+    }
+  }
+}
+
 template <typename TBlocklike>
 WithBlocklikeCheck<void, TBlocklike>
 BlockBasedTable::SaveLookupContextOrTraceRecord(
@@ -1807,6 +1882,7 @@ void BlockBasedTable::FinishTraceRecord(
     const BlockCacheLookupContext& lookup_context, const Slice& block_key,
     const Slice& referenced_key, bool does_referenced_key_exist,
     uint64_t referenced_data_size) const {
+  TEST_SYNC_POINT("BlockBasedTable::FinishTraceRecord");
   // Avoid making copy of referenced_key if it doesn't need to be saved in
   // BlockCacheLookupContext
   BlockCacheTraceRecord access_record(
@@ -2366,8 +2442,11 @@ Status BlockBasedTable::Get(const ReadOptions& read_options, const Slice& key,
           break;
         }
       }
-      // Write the block cache access record.
-      if (block_cache_tracer_ && block_cache_tracer_->is_tracing_enabled()) {
+      // Write the block cache access record. Without a trace, the block key
+      // is only saved for blocks sampled by the simulator.
+      if (block_cache_tracer_ &&
+          (block_cache_tracer_->is_tracing_enabled() ||
+           !lookup_data_block_context.block_key.empty())) {
         // Avoid making copy of block_key, cf_name, and referenced_key when
         // constructing the access record.
         Slice referenced_key;
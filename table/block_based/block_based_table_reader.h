@@ -381,6 +381,18 @@ class BlockBasedTable : public TableReader {
       BlockCacheLookupContext* lookup_context, bool for_compaction,
       bool use_cache, bool async_read, bool use_block_cache_for_lookup) const;
 
+  // Looks up `count` blocks in the block cache, which must be configured,
+  // waiting for all of them together so that any secondary cache lookups are
+  // done in parallel. Each entry of `out_parsed_blocks` is left empty on a
+  // miss. Only cache hit and miss metrics are updated; reading missing blocks
+  // from the file is up to the caller.
+  template <typename TBlocklike>
+  WithBlocklikeCheck<void, TBlocklike> LookupBlocksInCacheBatched(
+      const ReadOptions& ro, const BlockHandle* handles, size_t count,
+      const UncompressionDict& uncompression_dict, GetContext* get_context,
+      BlockCacheLookupContext* lookup_context,
+      CachableEntry<TBlocklike>* out_parsed_blocks) const;
+
   template <typename TBlocklike>
   WithBlocklikeCheck<void, TBlocklike> SaveLookupContextOrTraceRecord(
       const Slice& block_key, bool is_cache_hit, const ReadOptions& ro,
@@ -420,6 +432,14 @@ class BlockBasedTable : public TableReader {
   template <typename TBlocklike>
   Cache::Priority GetCachePriority() const;
 
+  // Priority for inserting a block read on behalf of `lookup_context` into
+  // the block cache. Same as GetCachePriority() except for data blocks read
+  // by a sequential scan (see
+  // BlockBasedTableOptions::bottom_priority_for_scan_blocks).
+  template <typename TBlocklike>
+  Cache::Priority GetCacheInsertPriority(
+      const BlockCacheLookupContext* lookup_context) const;
+
   // Read block cache from block caches (if set): block_cache.
   // On success, Status::OK with be returned and @block will be populated with
   // pointer to the block as well as its block handle.
@@ -449,7 +469,8 @@ class BlockBasedTable : public TableReader {
       BlockContents&& compressed_block_contents,
       CompressionType block_comp_type,
       const UncompressionDict& uncompression_dict,
-      MemoryAllocator* memory_allocator, GetContext* get_context) const;
+      MemoryAllocator* memory_allocator, GetContext* get_context,
+      Cache::Priority priority) const;
 
   // Calls (*handle_result)(arg, ...) repeatedly, starting with the entry found
   // after a call to Seek(key), until handle_result returns false.
@@ -411,7 +411,8 @@ DEFINE_SYNC_AND_ASYNC(void, BlockBasedTable::MultiGet)
     MultiGetContext::Mask reused_mask = 0;
     char stack_buf[kMultiGetReadStackBufSize];
     std::unique_ptr<char[]> block_buf;
-    if (block_cache_tracer_ && block_cache_tracer_->is_tracing_enabled()) {
+    if (block_cache_tracer_ && (block_cache_tracer_->is_tracing_enabled() ||
+                                block_cache_tracer_->is_simulation_enabled())) {
       // Awkward because BlockCacheLookupContext is not CopyAssignable
       data_lookup_contexts.reserve(MultiGetContext::MAX_BATCH_SIZE);
       for (size_t i = 0; i < MultiGetContext::MAX_BATCH_SIZE; ++i) {
@@ -551,7 +552,9 @@ DEFINE_SYNC_AND_ASYNC(void, BlockBasedTable::MultiGet)
               total_len += BlockSizeWithTrailer(block_handles[i]);
               UpdateCacheMissMetrics(BlockType::kData, get_context);
             }
-            if (!data_lookup_contexts.empty()) {
+            if (!data_lookup_contexts.empty() &&
+                block_cache_tracer_->ShouldRecordBlockAccess(
+                    async_handles[lookup_idx].key)) {
               // Populate cache key before it's discarded
               data_lookup_contexts[i].block_key =
                   async_handles[lookup_idx].key.ToString();
@@ -767,7 +770,9 @@ DEFINE_SYNC_AND_ASYNC(void, BlockBasedTable::MultiGet)
         // Write the block cache access.
         // XXX: There appear to be 'break' statements above that bypass this
         // writing of the block cache trace record
-        if (lookup_data_block_context && !reusing_prev_block && first_block) {
+        if (lookup_data_block_context && !reusing_prev_block && first_block &&
+            (block_cache_tracer_->is_tracing_enabled() ||
+             !lookup_data_block_context->block_key.empty())) {
           Slice referenced_key;
           if (does_referenced_key_exist) {
             referenced_key = biter->key();
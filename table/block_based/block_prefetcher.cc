@@ -8,6 +8,8 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 #include "table/block_based/block_prefetcher.h"
 
+#include <algorithm>
+
 #include "rocksdb/file_system.h"
 #include "table/block_based/block_based_table_reader.h"
 
@@ -18,6 +20,10 @@ void BlockPrefetcher::PrefetchIfNeeded(
     const bool no_sequential_checking, const ReadOptions& read_options,
     const std::function<void(bool, uint64_t&, uint64_t&)>& readaheadsize_cb,
     bool is_async_io_prefetch) {
+  const size_t len = BlockBasedTable::BlockSizeWithTrailer(handle);
+  const size_t offset = handle.offset();
+  UpdateSequentialScan(rep, offset, len, is_for_compaction);
+
   if (read_options.read_tier == ReadTier::kBlockCacheTier) {
     // Disable prefetching when IO disallowed. (Note that we haven't allocated
     // any buffers yet despite the various tracked settings.)
@@ -29,8 +35,6 @@ void BlockPrefetcher::PrefetchIfNeeded(
   readahead_params.max_readahead_size = readahead_size;
   readahead_params.num_buffers = is_async_io_prefetch ? 2 : 1;
 
-  const size_t len = BlockBasedTable::BlockSizeWithTrailer(handle);
-  const size_t offset = handle.offset();
   if (is_for_compaction) {
     if (!rep->file->use_direct_io() && compaction_readahead_size_ > 0) {
       // If FS supports prefetching (readahead_limit_ will be non zero in that
@@ -155,4 +159,25 @@ void BlockPrefetcher::PrefetchIfNeeded(
   // max_auto_readahead_size.
   readahead_size_ = std::min(max_auto_readahead_size, readahead_size_ * 2);
 }
+
+void BlockPrefetcher::UpdateSequentialScan(const BlockBasedTable::Rep* rep,
+                                           size_t offset, size_t len,
+                                           bool is_for_compaction) {
+  // Tracked independently of readahead, which might be in effect from the
+  // first block (e.g. with ReadOptions::readahead_size or async_io).
+  if (is_for_compaction) {
+    in_sequential_scan_ = true;
+    return;
+  }
+  if (num_sequential_blocks_ > 0 && offset == sequential_end_offset_) {
+    ++num_sequential_blocks_;
+  } else {
+    num_sequential_blocks_ = 1;
+  }
+  sequential_end_offset_ = offset + len;
+  in_sequential_scan_ =
+      num_sequential_blocks_ >
+      std::max(rep->table_options.num_file_reads_for_auto_readahead,
+               uint64_t{1});
+}
 }  // namespace ROCKSDB_NAMESPACE
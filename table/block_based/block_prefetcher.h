@@ -35,6 +35,11 @@ class BlockPrefetcher {
     return (prev_len_ == 0 || (prev_offset_ + prev_len_ == offset));
   }
 
+  // Whether the block passed to the last PrefetchIfNeeded() call is read as
+  // part of a sequential scan, i.e. it follows more than
+  // `num_file_reads_for_auto_readahead` (at least one) consecutive blocks.
+  bool InSequentialScan() const { return in_sequential_scan_; }
+
   void ResetValues(size_t initial_auto_readahead_size) {
     num_file_reads_ = 1;
     // Since initial_auto_readahead_size_ can be different from
@@ -55,6 +60,9 @@ class BlockPrefetcher {
   }
 
  private:
+  void UpdateSequentialScan(const BlockBasedTable::Rep* rep, size_t offset,
+                            size_t len, bool is_for_compaction);
+
   // Readahead size used in compaction, its value is used only if
   // lookup_context_.caller = kCompaction.
   size_t compaction_readahead_size_;
@@ -69,6 +77,10 @@ class BlockPrefetcher {
   uint64_t num_file_reads_ = 0;
   uint64_t prev_offset_ = 0;
   size_t prev_len_ = 0;
+  // Number of consecutive blocks read, ending at `sequential_end_offset_`
+  uint64_t num_sequential_blocks_ = 0;
+  uint64_t sequential_end_offset_ = 0;
+  bool in_sequential_scan_ = false;
   std::unique_ptr<FilePrefetchBuffer> prefetch_buffer_;
 };
 }  // namespace ROCKSDB_NAMESPACE
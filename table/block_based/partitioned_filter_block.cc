@@ -5,6 +5,7 @@
 
 #include "table/block_based/partitioned_filter_block.h"
 
+#include <array>
 #include <utility>
 
 #include "block_cache.h"
@@ -396,7 +397,8 @@ Status PartitionedFilterBlockReader::GetFilterPartitionBlock(
     FilePrefetchBuffer* prefetch_buffer, const BlockHandle& fltr_blk_handle,
     GetContext* get_context, BlockCacheLookupContext* lookup_context,
     const ReadOptions& read_options,
-    CachableEntry<ParsedFullFilterBlock>* filter_block) const {
+    CachableEntry<ParsedFullFilterBlock>* filter_block,
+    bool use_block_cache_for_lookup) const {
   assert(table());
   assert(filter_block);
   assert(filter_block->IsEmpty());
@@ -416,7 +418,7 @@ Status PartitionedFilterBlockReader::GetFilterPartitionBlock(
       UncompressionDict::GetEmptyDict(), filter_block, get_context,
       lookup_context,
       /* for_compaction */ false, /* use_cache */ true,
-      /* async_read */ false, /* use_block_cache_for_lookup */ true);
+      /* async_read */ false, use_block_cache_for_lookup);
 
   return s;
 }
@@ -473,22 +475,67 @@ void PartitionedFilterBlockReader::MayMatch(
     return;  // Any/all may match
   }
 
+  // Find the partition of each key up front, so that the partitions not
+  // pinned in filter_map_ can be looked up in the block cache together. That
+  // way lookups in a secondary cache proceed in parallel rather than one after
+  // the other.
+  autovector<BlockHandle, MultiGetContext::MAX_BATCH_SIZE> key_handles;
+  std::array<BlockHandle, MultiGetContext::MAX_BATCH_SIZE> lookup_handles;
+  size_t num_lookups = 0;
+  for (auto iter = range->begin(); iter != range->end(); ++iter) {
+    // TODO: re-use one top-level index iterator
+    BlockHandle this_filter_handle =
+        GetFilterPartitionHandle(filter_block, iter->ikey);
+    key_handles.push_back(this_filter_handle);
+    if (this_filter_handle.size() != 0 &&
+        (num_lookups == 0 ||
+         lookup_handles[num_lookups - 1] != this_filter_handle) &&
+        filter_map_.find(this_filter_handle.offset()) == filter_map_.end()) {
+      lookup_handles[num_lookups++] = this_filter_handle;
+    }
+  }
+  std::array<CachableEntry<ParsedFullFilterBlock>,
+             MultiGetContext::MAX_BATCH_SIZE>
+      lookup_results;
+  const bool batched_lookup =
+      num_lookups > 1 && table()->get_rep()->table_options.block_cache;
+  if (batched_lookup) {
+    table()->LookupBlocksInCacheBatched(
+        read_options, lookup_handles.data(), num_lookups,
+        UncompressionDict::GetEmptyDict(), range->begin()->get_context,
+        lookup_context, lookup_results.data());
+  }
+  size_t lookup_idx = 0;
+  auto match_partition = [&](MultiGetRange::Iterator begin,
+                             MultiGetRange::Iterator end,
+                             const BlockHandle& filter_handle) {
+    CachableEntry<ParsedFullFilterBlock> filter_partition_block;
+    bool looked_up_in_cache = false;
+    if (batched_lookup && lookup_idx < num_lookups &&
+        lookup_handles[lookup_idx] == filter_handle) {
+      filter_partition_block = std::move(lookup_results[lookup_idx]);
+      looked_up_in_cache = true;
+      ++lookup_idx;
+    }
+    MultiGetRange subrange(*range, begin, end);
+    MayMatchPartition(&subrange, prefix_extractor, filter_handle,
+                      lookup_context, read_options, filter_function,
+                      std::move(filter_partition_block), looked_up_in_cache);
+    range->AddSkipsFrom(subrange);
+  };
+
   auto start_iter_same_handle = range->begin();
   BlockHandle prev_filter_handle = BlockHandle::NullBlockHandle();
 
   // For all keys mapping to same partition (must be adjacent in sorted order)
   // share block cache lookup and use full filter multiget on the partition
   // filter.
+  size_t key_idx = 0;
   for (auto iter = start_iter_same_handle; iter != range->end(); ++iter) {
-    // TODO: re-use one top-level index iterator
-    BlockHandle this_filter_handle =
-        GetFilterPartitionHandle(filter_block, iter->ikey);
+    const BlockHandle& this_filter_handle = key_handles[key_idx++];
     if (!prev_filter_handle.IsNull() &&
         this_filter_handle != prev_filter_handle) {
-      MultiGetRange subrange(*range, start_iter_same_handle, iter);
-      MayMatchPartition(&subrange, prefix_extractor, prev_filter_handle,
-                        lookup_context, read_options, filter_function);
-      range->AddSkipsFrom(subrange);
+      match_partition(start_iter_same_handle, iter, prev_filter_handle);
       start_iter_same_handle = iter;
     }
     if (UNLIKELY(this_filter_handle.size() == 0)) {  // key is out of range
@@ -501,24 +548,26 @@ void PartitionedFilterBlockReader::MayMatch(
     }
   }
   if (!prev_filter_handle.IsNull()) {
-    MultiGetRange subrange(*range, start_iter_same_handle, range->end());
-    MayMatchPartition(&subrange, prefix_extractor, prev_filter_handle,
-                      lookup_context, read_options, filter_function);
-    range->AddSkipsFrom(subrange);
+    match_partition(start_iter_same_handle, range->end(), prev_filter_handle);
   }
 }
 
 void PartitionedFilterBlockReader::MayMatchPartition(
     MultiGetRange* range, const SliceTransform* prefix_extractor,
     BlockHandle filter_handle, BlockCacheLookupContext* lookup_context,
-    const ReadOptions& read_options, FilterManyFunction filter_function) const {
-  CachableEntry<ParsedFullFilterBlock> filter_partition_block;
-  Status s = GetFilterPartitionBlock(
-      nullptr /* prefetch_buffer */, filter_handle, range->begin()->get_context,
-      lookup_context, read_options, &filter_partition_block);
-  if (UNLIKELY(!s.ok())) {
-    IGNORE_STATUS_IF_ERROR(s);
-    return;  // Any/all may match
+    const ReadOptions& read_options, FilterManyFunction filter_function,
+    CachableEntry<ParsedFullFilterBlock>&& filter_partition_block,
+    bool looked_up_in_cache) const {
+  if (filter_partition_block.IsEmpty()) {
+    Status s = GetFilterPartitionBlock(
+        nullptr /* prefetch_buffer */, filter_handle,
+        range->begin()->get_context, lookup_context, read_options,
+        &filter_partition_block,
+        /* use_block_cache_for_lookup */ !looked_up_in_cache);
+    if (UNLIKELY(!s.ok())) {
+      IGNORE_STATUS_IF_ERROR(s);
+      return;  // Any/all may match
+    }
   }
 
   FullFilterBlockReader filter_partition(table(),
@@ -167,7 +167,8 @@ class PartitionedFilterBlockReader
       FilePrefetchBuffer* prefetch_buffer, const BlockHandle& handle,
       GetContext* get_context, BlockCacheLookupContext* lookup_context,
       const ReadOptions& read_options,
-      CachableEntry<ParsedFullFilterBlock>* filter_block) const;
+      CachableEntry<ParsedFullFilterBlock>* filter_block,
+      bool use_block_cache_for_lookup = true) const;
 
   using FilterFunction = bool (FullFilterBlockReader::*)(
       const Slice& slice, const Slice* const const_ikey_ptr,
@@ -185,12 +186,15 @@ class PartitionedFilterBlockReader
                 BlockCacheLookupContext* lookup_context,
                 const ReadOptions& read_options,
                 FilterManyFunction filter_function) const;
-  void MayMatchPartition(MultiGetRange* range,
-                         const SliceTransform* prefix_extractor,
-                         BlockHandle filter_handle,
-                         BlockCacheLookupContext* lookup_context,
-                         const ReadOptions& read_options,
-                         FilterManyFunction filter_function) const;
+  // `filter_partition_block` is the partition if already found in the block
+  // cache, or empty. If empty and `looked_up_in_cache`, the partition is known
+  // to be missing from the block cache.
+  void MayMatchPartition(
+      MultiGetRange* range, const SliceTransform* prefix_extractor,
+      BlockHandle filter_handle, BlockCacheLookupContext* lookup_context,
+      const ReadOptions& read_options, FilterManyFunction filter_function,
+      CachableEntry<ParsedFullFilterBlock>&& filter_partition_block,
+      bool looked_up_in_cache) const;
   Status CacheDependencies(const ReadOptions& ro, bool pin,
                            FilePrefetchBuffer* tail_prefetch_buffer) override;
   void EraseFromCacheBeforeDestruction(
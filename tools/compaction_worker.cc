@@ -0,0 +1,11 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+//
+
+#include "rocksdb/utilities/local_compaction_service.h"
+
+int main(int argc, char** argv) {
+  return ROCKSDB_NAMESPACE::RunLocalCompactionServiceWorker(argc, argv);
+}
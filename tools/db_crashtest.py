@@ -71,7 +71,7 @@ default_params = {
     # Disabled because of various likely related failures with
     # "Cannot delete table file #N from level 0 since it is on level X"
     "promote_l0_one_in": 0,
-    "compaction_pri": random.randint(0, 4),
+    "compaction_pri": random.randint(0, 5),
     "key_may_exist_one_in": lambda: random.choice([100, 100000]),
     "data_block_index_type": lambda: random.choice([0, 1]),
     "decouple_partitioned_filters": lambda: random.choice([0, 1, 1]),
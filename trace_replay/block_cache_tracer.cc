@@ -472,10 +472,25 @@ void BlockCacheTracer::EndTrace() {
   writer_.store(nullptr);
 }
 
+void BlockCacheTracer::SetSimulator(
+    const BlockCacheTraceOptions& simulation_options,
+    BlockCacheTraceWriter* simulator) {
+  simulation_options_ = simulation_options;
+  simulator_ = simulator;
+}
+
+bool BlockCacheTracer::ShouldSimulate(const Slice& block_key) const {
+  return ShouldTrace(block_key, simulation_options_);
+}
+
 Status BlockCacheTracer::WriteBlockAccess(const BlockCacheTraceRecord& record,
                                           const Slice& block_key,
                                           const Slice& cf_name,
                                           const Slice& referenced_key) {
+  if (simulator_ && ShouldSimulate(block_key)) {
+    simulator_->WriteBlockAccess(record, block_key, cf_name, referenced_key)
+        .PermitUncheckedError();
+  }
   if (!writer_.load() || !ShouldTrace(block_key, trace_options_)) {
     return Status::OK();
   }
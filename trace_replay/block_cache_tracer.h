@@ -89,6 +89,10 @@ struct BlockCacheLookupContext {
   uint64_t get_id = 0;
   std::string referenced_key;
   bool get_from_user_specified_snapshot = false;
+  // Set by iterators when the block being read is part of a sequential scan.
+  // Used to pick the block cache insertion priority (see
+  // BlockBasedTableOptions::bottom_priority_for_scan_blocks).
+  bool in_sequential_scan = false;
 
   void FillLookupContext(bool _is_cache_hit, bool _no_insert,
                          TraceType _block_type, uint64_t _block_size,
@@ -217,10 +221,29 @@ class BlockCacheTracer {
   // Stop writing block cache accesses to the trace_writer.
   void EndTrace();
 
+  // Additionally pass a sample of block cache accesses, independent of any
+  // trace, to `simulator` for the lifetime of this object. `simulator` is not
+  // owned and must outlive this object. Must be called before any access is
+  // recorded.
+  void SetSimulator(const BlockCacheTraceOptions& simulation_options,
+                    BlockCacheTraceWriter* simulator);
+
+  // Whether a trace is being written. Does not cover the simulator.
   bool is_tracing_enabled() const {
     return writer_.load(std::memory_order_relaxed);
   }
 
+  bool is_simulation_enabled() const { return simulator_ != nullptr; }
+
+  // Whether an access to the block with `block_key` needs to be recorded,
+  // i.e. passed to WriteBlockAccess(). Cheap enough to be called on every
+  // block cache access, so that no access record has to be built for blocks
+  // that the simulator does not sample.
+  bool ShouldRecordBlockAccess(const Slice& block_key) const {
+    return is_tracing_enabled() ||
+           (simulator_ != nullptr && ShouldSimulate(block_key));
+  }
+
   Status WriteBlockAccess(const BlockCacheTraceRecord& record,
                           const Slice& block_key, const Slice& cf_name,
                           const Slice& referenced_key);
@@ -229,7 +252,11 @@ class BlockCacheTracer {
   uint64_t NextGetId();
 
  private:
+  bool ShouldSimulate(const Slice& block_key) const;
+
   BlockCacheTraceOptions trace_options_;
+  BlockCacheTraceOptions simulation_options_;
+  BlockCacheTraceWriter* simulator_ = nullptr;
   // A mutex protects the writer_.
   InstrumentedMutex trace_writer_mutex_;
   std::atomic<BlockCacheTraceWriter*> writer_;
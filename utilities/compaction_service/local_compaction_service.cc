@@ -0,0 +1,343 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "rocksdb/utilities/local_compaction_service.h"
+
+#ifndef OS_WIN
+#include <signal.h>
+#include <spawn.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif  // OS_WIN
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#include "db/compaction/compaction_job.h"
+#include "file/file_util.h"
+#include "file/filename.h"
+#include "port/port.h"
+#include "rocksdb/convenience.h"
+#include "rocksdb/db.h"
+#include "rocksdb/env.h"
+#include "rocksdb/utilities/options_util.h"
+#include "util/mutexlock.h"
+
+#ifndef OS_WIN
+extern char** environ;
+#endif  // OS_WIN
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+
+const char* const kInputFileName = "INPUT";
+const char* const kResultFileName = "RESULT";
+const char* const kOutputDirName = "output";
+const char* const kDbArg = "--db=";
+const char* const kJobDirArg = "--job_dir=";
+
+class LocalCompactionService : public CompactionService {
+ public:
+  explicit LocalCompactionService(const LocalCompactionServiceOptions& options)
+      : options_(options), env_(Env::Default()), cv_(&mutex_) {
+    assert(options_.max_workers > 0);
+  }
+
+  static const char* kClassName() { return "LocalCompactionService"; }
+
+  const char* Name() const override { return kClassName(); }
+
+  CompactionServiceScheduleResponse Schedule(
+      const CompactionServiceJobInfo& info,
+      const std::string& compaction_service_input) override {
+#ifdef OS_WIN
+    (void)info;
+    (void)compaction_service_input;
+    return CompactionServiceScheduleResponse(
+        CompactionServiceJobStatus::kUseLocal);
+#else
+    // Unique across DBs and sessions sharing the work directory
+    std::string job_id = info.db_session_id + "-" + std::to_string(info.job_id);
+    std::string job_dir = GetJobDir(job_id);
+    Status s = env_->CreateDirIfMissing(options_.work_dir);
+    if (s.ok()) {
+      s = env_->CreateDir(job_dir);
+    }
+    if (s.ok()) {
+      s = WriteStringToFile(env_, compaction_service_input,
+                            job_dir + "/" + kInputFileName,
+                            /*should_sync=*/false);
+    }
+    if (!s.ok()) {
+      DestroyDir(env_, job_dir).PermitUncheckedError();
+      return CompactionServiceScheduleResponse(
+          CompactionServiceJobStatus::kFailure);
+    }
+
+    MutexLock l(&mutex_);
+    jobs_[job_id].db_name = info.db_name;
+    return CompactionServiceScheduleResponse(
+        std::move(job_id), CompactionServiceJobStatus::kSuccess);
+#endif  // OS_WIN
+  }
+
+  CompactionServiceJobStatus Wait(const std::string& scheduled_job_id,
+                                  std::string* result) override {
+#ifdef OS_WIN
+    (void)scheduled_job_id;
+    (void)result;
+    return CompactionServiceJobStatus::kUseLocal;
+#else
+    const std::string job_dir = GetJobDir(scheduled_job_id);
+    std::string db_name;
+    bool canceled = false;
+    {
+      MutexLock l(&mutex_);
+      auto it = jobs_.find(scheduled_job_id);
+      if (it == jobs_.end()) {
+        return CompactionServiceJobStatus::kFailure;
+      }
+      // Wait in the queue for a free worker
+      while (!it->second.canceled && num_running_ >= options_.max_workers) {
+        cv_.Wait();
+      }
+      canceled = it->second.canceled;
+      if (!canceled) {
+        ++num_running_;
+        db_name = it->second.db_name;
+      }
+    }
+
+    bool succeeded = false;
+    if (!canceled) {
+      // Process creation can be slow, so it happens without holding the mutex
+      pid_t pid = SpawnWorker(db_name, job_dir);
+      if (pid > 0) {
+        {
+          MutexLock l(&mutex_);
+          Job& job = GetJob(scheduled_job_id);
+          job.pid = pid;
+          if (job.canceled) {
+            // Canceled while the worker was being created
+            kill(pid, SIGTERM);
+          }
+        }
+        // Wait for the worker to exit without reaping it, so that its pid
+        // cannot be reused while CancelAwaitingJobs() might still signal it
+        siginfo_t info;
+        memset(&info, 0, sizeof(info));
+        int ret;
+        do {
+          ret = waitid(P_PID, pid, &info, WEXITED | WNOWAIT);
+        } while (ret < 0 && errno == EINTR);
+        MutexLock l(&mutex_);
+        Job& job = GetJob(scheduled_job_id);
+        job.pid = -1;
+        int wait_status = 0;
+        waitpid(pid, &wait_status, 0);
+        succeeded = ret == 0 && info.si_code == CLD_EXITED &&
+                    info.si_status == 0 && !job.canceled;
+      }
+      MutexLock l(&mutex_);
+      --num_running_;
+      cv_.SignalAll();
+    }
+
+    // Even a failed worker might have left a result with the failure status
+    Status s = ReadFileToString(env_, job_dir + "/" + kResultFileName, result);
+    if (succeeded && s.ok()) {
+      // Cleaned up on installation
+      return CompactionServiceJobStatus::kSuccess;
+    }
+    Cleanup(scheduled_job_id);
+    return CompactionServiceJobStatus::kFailure;
+#endif  // OS_WIN
+  }
+
+  void CancelAwaitingJobs() override {
+    MutexLock l(&mutex_);
+    for (auto& job : jobs_) {
+      job.second.canceled = true;
+#ifndef OS_WIN
+      if (job.second.pid > 0) {
+        kill(job.second.pid, SIGTERM);
+      }
+#endif  // OS_WIN
+    }
+    cv_.SignalAll();
+  }
+
+  void OnInstallation(const std::string& scheduled_job_id,
+                      CompactionServiceJobStatus /*status*/) override {
+    Cleanup(scheduled_job_id);
+  }
+
+ private:
+  struct Job {
+    std::string db_name;
+    // Worker process running the job, if any
+    int pid = -1;
+    bool canceled = false;
+  };
+
+  // REQUIRES: mutex_ held, and the job is still known (it is only forgotten
+  // by Wait() or OnInstallation() of the job itself)
+  Job& GetJob(const std::string& job_id) {
+    mutex_.AssertHeld();
+    auto it = jobs_.find(job_id);
+    assert(it != jobs_.end());
+    return it->second;
+  }
+
+  std::string GetJobDir(const std::string& job_id) const {
+    return options_.work_dir + "/" + job_id;
+  }
+
+  void Cleanup(const std::string& job_id) {
+    DestroyDir(env_, GetJobDir(job_id)).PermitUncheckedError();
+    MutexLock l(&mutex_);
+    jobs_.erase(job_id);
+  }
+
+#ifndef OS_WIN
+  // Returns the pid of the new worker process, or -1 on failure
+  pid_t SpawnWorker(const std::string& db_name, const std::string& job_dir) {
+    std::vector<std::string> args;
+    args.push_back(options_.worker_path);
+    args.insert(args.end(), options_.worker_args.begin(),
+                options_.worker_args.end());
+    args.push_back(kDbArg + db_name);
+    args.push_back(kJobDirArg + job_dir);
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+      argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid;
+    if (posix_spawn(&pid, options_.worker_path.c_str(), nullptr, nullptr,
+                    argv.data(), environ) != 0) {
+      return -1;
+    }
+    return pid;
+  }
+#endif  // OS_WIN
+
+  const LocalCompactionServiceOptions options_;
+  Env* const env_;
+  port::Mutex mutex_;
+  port::CondVar cv_;
+  std::unordered_map<std::string, Job> jobs_;
+  int num_running_ = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<CompactionService> NewLocalCompactionService(
+    const LocalCompactionServiceOptions& options) {
+  return std::make_shared<LocalCompactionService>(options);
+}
+
+Status RunLocalCompactionServiceJob(
+    const std::string& db_name, const std::string& job_dir,
+    const CompactionServiceOptionsOverride* override_options) {
+  Env* env = Env::Default();
+  std::string input;
+  Status s = ReadFileToString(env, job_dir + "/" + kInputFileName, &input);
+  if (!s.ok()) {
+    return s;
+  }
+
+  CompactionServiceOptionsOverride loaded_options;
+  if (override_options == nullptr) {
+    CompactionServiceInput compaction_input;
+    s = CompactionServiceInput::Read(input, &compaction_input);
+    if (!s.ok()) {
+      return s;
+    }
+    ConfigOptions config_options;
+    config_options.env = env;
+    DBOptions db_options;
+    std::vector<ColumnFamilyDescriptor> column_families;
+    s = LoadOptionsFromFile(
+        config_options,
+        OptionsFileName(db_name, compaction_input.options_file_number),
+        &db_options, &column_families);
+    if (!s.ok()) {
+      return s;
+    }
+    const ColumnFamilyOptions* cf_options = nullptr;
+    for (const auto& cf : column_families) {
+      if (cf.name == compaction_input.cf_name) {
+        cf_options = &cf.options;
+        break;
+      }
+    }
+    if (cf_options == nullptr) {
+      return Status::InvalidArgument("Column family not found in options",
+                                     compaction_input.cf_name);
+    }
+    loaded_options.env = env;
+    loaded_options.file_checksum_gen_factory =
+        db_options.file_checksum_gen_factory;
+    loaded_options.comparator = cf_options->comparator;
+    loaded_options.merge_operator = cf_options->merge_operator;
+    loaded_options.compaction_filter = cf_options->compaction_filter;
+    loaded_options.compaction_filter_factory =
+        cf_options->compaction_filter_factory;
+    loaded_options.prefix_extractor = cf_options->prefix_extractor;
+    loaded_options.table_factory = cf_options->table_factory;
+    loaded_options.sst_partitioner_factory =
+        cf_options->sst_partitioner_factory;
+    loaded_options.table_properties_collector_factories =
+        cf_options->table_properties_collector_factories;
+    override_options = &loaded_options;
+  }
+
+  std::string result;
+  s = DB::OpenAndCompact(db_name, job_dir + "/" + kOutputDirName, input,
+                         &result, *override_options);
+  if (!result.empty()) {
+    Status ws = WriteStringToFile(env, result, job_dir + "/" + kResultFileName,
+                                  /*should_sync=*/true);
+    if (s.ok()) {
+      s = ws;
+    } else {
+      ws.PermitUncheckedError();
+    }
+  }
+  return s;
+}
+
+int RunLocalCompactionServiceWorker(int argc, char** argv) {
+  std::string db_name;
+  std::string job_dir;
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kDbArg, strlen(kDbArg)) == 0) {
+      db_name = argv[i] + strlen(kDbArg);
+    } else if (strncmp(argv[i], kJobDirArg, strlen(kJobDirArg)) == 0) {
+      job_dir = argv[i] + strlen(kJobDirArg);
+    }
+  }
+  if (db_name.empty() || job_dir.empty()) {
+    fprintf(stderr, "Usage: %s --db=<db name> --job_dir=<job directory>\n",
+            argv[0]);
+    return 1;
+  }
+  Status s = RunLocalCompactionServiceJob(db_name, job_dir);
+  if (!s.ok()) {
+    fprintf(stderr, "Compaction job in %s failed: %s\n", job_dir.c_str(),
+            s.ToString().c_str());
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace ROCKSDB_NAMESPACE
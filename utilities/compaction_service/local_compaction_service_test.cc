@@ -0,0 +1,145 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "rocksdb/utilities/local_compaction_service.h"
+
+#include <cstring>
+
+#include "db/db_test_util.h"
+#include "file/file_util.h"
+#include "port/stack_trace.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+// This test binary doubles as the worker executable
+std::string worker_path;
+}  // namespace
+
+class LocalCompactionServiceTest : public DBTestBase {
+ public:
+  LocalCompactionServiceTest()
+      : DBTestBase("local_compaction_service_test", /*env_do_fsync=*/false) {
+    work_dir_ = test::PerThreadDBPath(env_, "local_compaction_service_work");
+  }
+
+  ~LocalCompactionServiceTest() override {
+    DestroyDir(env_, work_dir_).PermitUncheckedError();
+  }
+
+  LocalCompactionServiceOptions GetServiceOptions() {
+    LocalCompactionServiceOptions service_options;
+    service_options.worker_path = worker_path;
+    service_options.work_dir = work_dir_;
+    service_options.max_workers = 2;
+    return service_options;
+  }
+
+  // Number of job directories left behind
+  size_t NumJobDirs() {
+    std::vector<std::string> children;
+    if (!env_->GetChildren(work_dir_, &children).ok()) {
+      return 0;
+    }
+    return children.size();
+  }
+
+ protected:
+  std::string work_dir_;
+};
+
+TEST_F(LocalCompactionServiceTest, Basic) {
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  options.statistics = CreateDBStatistics();
+  options.compaction_service = NewLocalCompactionService(GetServiceOptions());
+  DestroyAndReopen(options);
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 100; ++j) {
+      ASSERT_OK(Put(Key(j * 4 + i), "value" + std::to_string(i)));
+    }
+    // Overwrites
+    ASSERT_OK(Put(Key(i), "new_value" + std::to_string(i)));
+    ASSERT_OK(Flush());
+  }
+  ASSERT_EQ(NumTableFilesAtLevel(0), 4);
+
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(NumTableFilesAtLevel(0), 0);
+  ASSERT_GT(NumTableFilesAtLevel(1), 0);
+  ASSERT_GT(options.statistics->getTickerCount(REMOTE_COMPACT_WRITE_BYTES),
+            0u);
+  ASSERT_EQ(NumJobDirs(), 0u);
+
+  for (int j = 0; j < 100; ++j) {
+    for (int i = 0; i < 4; ++i) {
+      int k = j * 4 + i;
+      ASSERT_EQ(Get(Key(k)),
+                (k < 4 ? "new_value" : "value") + std::to_string(i));
+    }
+  }
+
+  // The result survives reopening
+  Reopen(options);
+  ASSERT_EQ(Get(Key(1)), "new_value1");
+  ASSERT_EQ(Get(Key(399)), "value3");
+}
+
+TEST_F(LocalCompactionServiceTest, WorkerFailure) {
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  LocalCompactionServiceOptions service_options = GetServiceOptions();
+  service_options.worker_path = work_dir_ + "/no_such_worker";
+  options.compaction_service = NewLocalCompactionService(service_options);
+  DestroyAndReopen(options);
+
+  // Overlapping files, so that the compaction is not a trivial move
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(Put(Key(0), "value" + std::to_string(i)));
+    ASSERT_OK(Put(Key(1), "value" + std::to_string(i)));
+    ASSERT_OK(Flush());
+  }
+  ASSERT_NOK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(NumTableFilesAtLevel(0), 2);
+  ASSERT_EQ(NumJobDirs(), 0u);
+  ASSERT_EQ(Get(Key(0)), "value1");
+}
+
+TEST_F(LocalCompactionServiceTest, CancelAwaitingJobs) {
+  std::shared_ptr<CompactionService> service =
+      NewLocalCompactionService(GetServiceOptions());
+  CompactionServiceJobInfo info(dbname_, "db_id", "session_id", 1,
+                                Env::Priority::LOW, CompactionReason::kUnknown,
+                                false, false, false);
+  CompactionServiceScheduleResponse response =
+      service->Schedule(info, "input");
+  ASSERT_EQ(response.status, CompactionServiceJobStatus::kSuccess);
+  ASSERT_EQ(NumJobDirs(), 1u);
+
+  service->CancelAwaitingJobs();
+  std::string result;
+  ASSERT_EQ(service->Wait(response.scheduled_job_id, &result),
+            CompactionServiceJobStatus::kFailure);
+  ASSERT_EQ(NumJobDirs(), 0u);
+
+  // Unknown job
+  ASSERT_EQ(service->Wait(response.scheduled_job_id, &result),
+            CompactionServiceJobStatus::kFailure);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--job_dir=", strlen("--job_dir=")) == 0) {
+      return ROCKSDB_NAMESPACE::RunLocalCompactionServiceWorker(argc, argv);
+    }
+  }
+  ROCKSDB_NAMESPACE::worker_path = argv[0];
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
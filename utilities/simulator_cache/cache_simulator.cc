@@ -6,9 +6,11 @@
 #include "utilities/simulator_cache/cache_simulator.h"
 
 #include <algorithm>
+#include <cinttypes>
 
 #include "db/dbformat.h"
 #include "rocksdb/trace_record.h"
+#include "util/mutexlock.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -284,4 +286,58 @@ void BlockCacheTraceSimulator::Access(const BlockCacheTraceRecord& access) {
   }
 }
 
+OnlineCacheSimulator::OnlineCacheSimulator(
+    const std::vector<uint64_t>& cache_capacities,
+    uint64_t sampling_frequency) {
+  sampling_frequency = std::max<uint64_t>(sampling_frequency, 1);
+  std::vector<uint64_t> capacities = cache_capacities;
+  std::sort(capacities.begin(), capacities.end());
+  capacities.erase(std::unique(capacities.begin(), capacities.end()),
+                   capacities.end());
+  for (uint64_t capacity : capacities) {
+    // A single shard, as a sampled cache is small and accesses are serialized
+    // by mutex_ anyway.
+    LRUCacheOptions cache_opts(capacity / sampling_frequency,
+                               /*num_shard_bits=*/0,
+                               /*strict_capacity_limit=*/false,
+                               /*high_pri_pool_ratio=*/0.0);
+    simulators_.emplace_back(
+        capacity, std::make_unique<CacheSimulator>(
+                      /*ghost_cache=*/nullptr, cache_opts.MakeSharedCache()));
+  }
+}
+
+Status OnlineCacheSimulator::WriteBlockAccess(
+    const BlockCacheTraceRecord& record, const Slice& block_key,
+    const Slice& /*cf_name*/, const Slice& /*referenced_key*/) {
+  BlockCacheTraceRecord access = record;
+  access.block_key = block_key.ToString();
+  // Only cumulative miss ratios are reported, so drop the timestamp to keep
+  // the per-second timelines in MissRatioStats from growing without bound.
+  access.access_timestamp = 0;
+  MutexLock lock(&mutex_);
+  for (auto& simulator : simulators_) {
+    simulator.second->Access(access);
+  }
+  return Status::OK();
+}
+
+std::string OnlineCacheSimulator::ToString() const {
+  std::string result;
+  char buf[200];
+  MutexLock lock(&mutex_);
+  for (const auto& simulator : simulators_) {
+    const MissRatioStats& stats = simulator.second->miss_ratio_stats();
+    snprintf(buf, sizeof(buf),
+             "capacity: %" PRIu64 " accesses: %" PRIu64
+             " miss ratio: %.2f user accesses: %" PRIu64
+             " user miss ratio: %.2f\n",
+             simulator.first, stats.total_accesses(),
+             std::max(stats.miss_ratio(), 0.0), stats.user_accesses(),
+             std::max(stats.user_miss_ratio(), 0.0));
+    result.append(buf);
+  }
+  return result;
+}
+
 }  // namespace ROCKSDB_NAMESPACE
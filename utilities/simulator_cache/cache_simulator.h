@@ -8,6 +8,8 @@
 #include <unordered_map>
 
 #include "cache/lru_cache.h"
+#include "port/port.h"
+#include "rocksdb/block_cache_trace_writer.h"
 #include "trace_replay/block_cache_tracer.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -228,4 +230,38 @@ class BlockCacheTraceSimulator {
   uint64_t trace_start_time_ = 0;
 };
 
+// Simulates LRU block caches of several capacities online, against the live
+// block cache accesses of a DB (see
+// DBOptions::block_cache_simulation_capacities). It is fed by
+// BlockCacheTracer as a BlockCacheTraceWriter, with accesses
+// sampled spatially (by block key) at one in `sampling_frequency`. Since only
+// that fraction of the blocks is seen, each simulated cache is scaled down by
+// the same factor.
+//
+// Thread-safe (provides internal synchronization)
+class OnlineCacheSimulator : public BlockCacheTraceWriter {
+ public:
+  OnlineCacheSimulator(const std::vector<uint64_t>& cache_capacities,
+                       uint64_t sampling_frequency);
+  // No copy and move.
+  OnlineCacheSimulator(const OnlineCacheSimulator&) = delete;
+  OnlineCacheSimulator& operator=(const OnlineCacheSimulator&) = delete;
+
+  Status WriteBlockAccess(const BlockCacheTraceRecord& record,
+                          const Slice& block_key, const Slice& cf_name,
+                          const Slice& referenced_key) override;
+
+  Status WriteHeader() override { return Status::OK(); }
+
+  // One line per simulated (unscaled) capacity with the number of sampled
+  // accesses and the miss ratios observed so far.
+  std::string ToString() const;
+
+ private:
+  mutable port::Mutex mutex_;
+  // Sorted by capacity
+  std::vector<std::pair<uint64_t, std::unique_ptr<CacheSimulator>>>
+      simulators_;
+};
+
 }  // namespace ROCKSDB_NAMESPACE